@@ -8,7 +8,13 @@
 #ifndef BITS_H_
 #define BITS_H_
 
+#include <limits.h>
+
+#if ULONG_MAX > 0xFFFFFFFFUL
+#define BITS_PER_LONG     64
+#else
 #define BITS_PER_LONG     32
+#endif
 
 #define BIT(nr)			(1UL << (nr))
 #define GENMASK(h, l) \
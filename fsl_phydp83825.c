@@ -6,620 +6,3448 @@
  */
 
 #include "fsl_phydp83825.h"
-
-#include "bits.h"
+#include "fsl_phydp83825_regs.h"
+#include "fsl_phydp83825_trace.h"
 
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
 
-#define DP83822_PHY_ID	    0x2000a240
-#define DP83825S_PHY_ID		0x2000a140
-#define DP83825I_PHY_ID		0x2000a150
-#define DP83825CM_PHY_ID	0x2000a160
-#define DP83825CS_PHY_ID	0x2000a170
-#define DP83826C_PHY_ID		0x2000a130
-#define DP83826NC_PHY_ID	0x2000a110
-
-#define DP83822_DEVADDR		0x1f
-
-#define MII_DP83822_CTRL_2	0x0a
-#define MII_DP83822_PHYSTS	0x10
-#define MII_DP83822_PHYSCR	0x11
-#define MII_DP83822_MISR1	0x12
-#define MII_DP83822_MISR2	0x13
-#define MII_DP83822_FCSCR	0x14
-#define MII_DP83822_BISCR   0x16
-#define MII_DP83822_RCSR	0x17
-#define MII_DP83822_PHYCR   0x19 /* Auto_MDI/X_Enable etc */
-#define MII_DP83822_RESET_CTRL	0x1f
-#define MII_DP83822_GENCFG	0x465
-#define MII_DP83822_SOR1	0x467
-
-/* DP83826 specific registers */
-#define MII_DP83826_VOD_CFG1	0x30b
-#define MII_DP83826_VOD_CFG2	0x30c
-
-/* GENCFG */
-#define DP83822_SIG_DET_LOW	BIT(0)
-
-/* Control Register 2 bits */
-#define DP83822_FX_ENABLE	BIT(14)
-
-#define DP83822_HW_RESET	BIT(15)
-#define DP83822_SW_RESET	BIT(14)
-
-/* PHY STS bits */
-#define DP83822_PHYSTS_DUPLEX		BIT(2)
-#define DP83822_PHYSTS_10			BIT(1)
-#define DP83822_PHYSTS_LINK			BIT(0)
-
-/* PHYSCR Register Fields */
-#define DP83822_PHYSCR_INT_OE		BIT(0) /* Interrupt Output Enable */
-#define DP83822_PHYSCR_INTEN		BIT(1) /* Interrupt Enable */
-
-/* MISR1 bits */
-#define DP83822_RX_ERR_HF_INT_EN		BIT(0)
-#define DP83822_FALSE_CARRIER_HF_INT_EN	BIT(1)
-#define DP83822_ANEG_COMPLETE_INT_EN	BIT(2)
-#define DP83822_DUP_MODE_CHANGE_INT_EN	BIT(3)
-#define DP83822_SPEED_CHANGED_INT_EN	BIT(4)
-#define DP83822_LINK_STAT_INT_EN		BIT(5)
-#define DP83822_ENERGY_DET_INT_EN		BIT(6)
-#define DP83822_LINK_QUAL_INT_EN		BIT(7)
-
-/* MISR2 bits */
-#define DP83822_JABBER_DET_INT_EN	BIT(0)
-#define DP83822_WOL_PKT_INT_EN		BIT(1)
-#define DP83822_SLEEP_MODE_INT_EN	BIT(2)
-#define DP83822_MDI_XOVER_INT_EN	BIT(3)
-#define DP83822_LB_FIFO_INT_EN		BIT(4)
-#define DP83822_PAGE_RX_INT_EN		BIT(5)
-#define DP83822_ANEG_ERR_INT_EN		BIT(6)
-#define DP83822_EEE_ERROR_CHANGE_INT_EN	BIT(7)
-
-/* INT_STAT1 bits */
-#define DP83822_WOL_INT_EN	BIT(4)
-#define DP83822_WOL_INT_STAT	BIT(12)
-
-#define MII_DP83822_RXSOP1	0x04a5
-#define	MII_DP83822_RXSOP2	0x04a6
-#define	MII_DP83822_RXSOP3	0x04a7
-
-/* WoL Registers */
-#define	MII_DP83822_WOL_CFG		0x04a0
-#define	MII_DP83822_WOL_STAT	0x04a1
-#define	MII_DP83822_WOL_DA1		0x04a2
-#define	MII_DP83822_WOL_DA2		0x04a3
-#define	MII_DP83822_WOL_DA3		0x04a4
-
-/* WoL bits */
-#define DP83822_WOL_MAGIC_EN	BIT(0)
-#define DP83822_WOL_SECURE_ON	BIT(5)
-#define DP83822_WOL_EN		BIT(7)
-#define DP83822_WOL_INDICATION_SEL BIT(8)
-#define DP83822_WOL_CLR_INDICATION BIT(11)
-
-/* PHYCR bits */
-#define DP83822_MDIX_AUTO_EN     BIT(15)
-#define DP83822_MDIX_FORCE_CROSS BIT(14)
-
-/* RCSR bits */
-/* 2 bit tolerance < 2400 byte packets (50ppm) */
-#define DP83822_ELASTICBUF_2B   0x1
-/* 6 bit tolerance < 7200 byte packets */
-#define DP83822_ELASTICBUF_6B   0x2
-/* 10 bit tolerance < 12000 byte packets */
-#define DP83822_ELASTICBUF_10B  0x3
-/* 14 bit tolerance < 16800 byte packets */
-#define DP83822_ELASTICBUF_14B  0x0
-#define DP83822_RMII_MODE_EN	BIT(5)
-#define DP83822_RMII_MODE_SEL	BIT(7)
-#define DP83822_RGMII_MODE_EN	BIT(9)
-#define DP83822_RX_CLK_SHIFT	BIT(12)
-#define DP83822_TX_CLK_SHIFT	BIT(11)
-
-/* SOR1 mode */
-#define DP83822_STRAP_MODE1	0
-#define DP83822_STRAP_MODE2	BIT(0)
-#define DP83822_STRAP_MODE3	BIT(1)
-#define DP83822_STRAP_MODE4	GENMASK(1, 0)
-
-#define DP83822_COL_STRAP_MASK	GENMASK(11, 10)
-#define DP83822_COL_SHIFT	10
-#define DP83822_RX_ER_STR_MASK	GENMASK(9, 8)
-#define DP83822_RX_ER_SHIFT	8
-
-/* DP83826: VOD_CFG1 & VOD_CFG2 */
-#define DP83826_VOD_CFG1_MINUS_MDIX_MASK	GENMASK(13, 12)
-#define DP83826_VOD_CFG1_MINUS_MDI_MASK		GENMASK(11, 6)
-#define DP83826_VOD_CFG2_MINUS_MDIX_MASK	GENMASK(15, 12)
-#define DP83826_VOD_CFG2_PLUS_MDIX_MASK		GENMASK(11, 6)
-#define DP83826_VOD_CFG2_PLUS_MDI_MASK		GENMASK(5, 0)
-#define DP83826_CFG_DAC_MINUS_MDIX_5_TO_4	GENMASK(5, 4)
-#define DP83826_CFG_DAC_MINUS_MDIX_3_TO_0	GENMASK(3, 0)
-#define DP83826_CFG_DAC_PERCENT_PER_STEP	625
-#define DP83826_CFG_DAC_PERCENT_DEFAULT		10000
-#define DP83826_CFG_DAC_MINUS_DEFAULT		0x30
-#define DP83826_CFG_DAC_PLUS_DEFAULT		0x10
-
-/* BISCR bits */
-#define DP83822_BISCR_LOOPBACKMODE_MASK    GENMASK(4,0)
-#define DP83822_LOOPBACKMODE_PCSIN         BIT(0)
-#define DP83822_LOOPBACKMODE_PCSOUT        BIT(1)
-#define DP83822_LOOPBACKMODE_DIGITAL       BIT(2)
-#define DP83822_LOOPBACKMODE_ANALOG        BIT(3)
-#define DP83822_LOOPBACKMODE_REVERSE       BIT(4)
-
-#define MII_DP83822_FIBER_ADVERTISE    (ADVERTISED_TP | ADVERTISED_MII | \
-					ADVERTISED_FIBRE | \
-					ADVERTISED_Pause | ADVERTISED_Asym_Pause)
-
 /*! @brief Defines the timeout macro. */
 #define PHY_READID_TIMEOUT_COUNT (1000U)
+#define PHY_RESET_TIMEOUT_MS     (100U)
+
+/*! @brief Defines the polling interval of the script wait entries. */
+#define PHY_SCRIPT_POLL_US (100U)
+
+/*! @brief Defines the error counter polling interval of PHY_DP83825_RunBist(). */
+#define PHY_DP83825_BIST_POLL_US (10000U)
+
+/*! @brief Defines the preamble and start of frame delimiter each BIST packet carries on the wire. */
+#define PHY_DP83825_BIST_PREAMBLE_BYTES (8U)
+
+/*! @brief Defines the cable diagnostic timeout and the TDR peak interpretation. */
+#define PHY_DP83825_CABLE_TIMEOUT_US      (200000U)
+#define PHY_DP83825_CABLE_CM_PER_SAMPLE   (83U) /* 8 ns round trip at 0.69 c */
+#define PHY_DP83825_CABLE_FAULT_AMPLITUDE (20U)
+#define PHY_DP83825_CABLE_NOISE_AMPLITUDE (6U)
+
+/*! @brief Defines the cable diagnostic job states. */
+enum _phy_dp83825_cable_state
+{
+    kPHY_DP83825_CableIdle = 0U,
+    kPHY_DP83825_CableWaitDone,
+    kPHY_DP83825_CableReadResults,
+};
+
+/*! @brief Defines the registers WOL_CFG to RXSOP3 read in one burst by PHY_DP83825_Checkpoint(). */
+#define PHY_DP83825_WOL_BURST_REGS (PHY_DP83825_CHECKPOINT_WOL_REGS + 2U)
+
+/*! @brief Defines the link flap penalty decay steps per half-life and the decay of one step, 2^(-1/8) in Q16. */
+#define PHY_DP83825_FLAP_DECAY_STEPS  (8U)
+#define PHY_DP83825_FLAP_DECAY_FACTOR (60097U)
+
+/*! @brief Defines the lowest DP83826 transmit amplitude. */
+#define PHY_DP83825_VOD_MIN_BP (5000U)
+
+/*! @brief Defines the MISR1 and MISR2 enable bits in phy_dp83825_config_t::interruptMask. */
+#define PHY_DP83825_INT_MISR1_MASK GENMASK(7, 0)
+#define PHY_DP83825_INT_MISR2_MASK GENMASK(15, 8)
+
+/*! @brief Defines the status register values answered by a hung MDIO bus. */
+#define PHY_DP83825_BUS_STUCK_HIGH (0xFFFFU)
+#define PHY_DP83825_BUS_STUCK_LOW  (0x0000U)
+
+/*! @brief Defines the MDIO frame types issued through the resource. */
+typedef enum _phy_dp83825_mdio_op
+{
+    kPHY_DP83825_MdioWrite = 0U,
+    kPHY_DP83825_MdioRead,
+    kPHY_DP83825_MdioWriteExt,
+    kPHY_DP83825_MdioReadExt,
+} phy_dp83825_mdio_op_t;
 
 /*! @brief Defines the PHY resource interface. */
 #define PHY_DP83825_WRITE(handle, regAddr, data) \
-    (((phy_dp83825_resource_t *)(handle)->resource)->write((handle)->phyAddr, regAddr, data))
+    PHY_DP83825_Mdio((handle), kPHY_DP83825_MdioWrite, 0U, (regAddr), &(uint16_t){(data)})
 #define PHY_DP83825_READ(handle, regAddr, pData) \
-    (((phy_dp83825_resource_t *)(handle)->resource)->read((handle)->phyAddr, regAddr, pData))
+    PHY_DP83825_Mdio((handle), kPHY_DP83825_MdioRead, 0U, (regAddr), (pData))
 #define PHY_DP83825_EXTWRITE(handle, devAddr, regAddr, data) \
-    (((phy_dp83825_resource_t *)(handle)->resource)->writeExt((handle)->phyAddr, devAddr, regAddr, data))
+    PHY_DP83825_Mdio((handle), kPHY_DP83825_MdioWriteExt, (devAddr), (regAddr), &(uint16_t){(data)})
 #define PHY_DP83825_EXTREAD(handle, devAddr, regAddr, pData) \
-    (((phy_dp83825_resource_t *)(handle)->resource)->readExt((handle)->phyAddr, devAddr, regAddr, pData))
+    PHY_DP83825_Mdio((handle), kPHY_DP83825_MdioReadExt, (devAddr), (regAddr), (pData))
 
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
+static status_t PHY_DP83825_Mdio(
+    phy_handle_t *handle, phy_dp83825_mdio_op_t op, uint8_t devAddr, uint16_t regAddr, uint16_t *data);
+static status_t PHY_DP83825_Configure(phy_handle_t *handle, const phy_config_t *config, bool reset);
+#if PHY_DP83825_ENABLE_DP83822
+static status_t PHY_DP83822_Init(phy_handle_t *handle, const phy_config_t *config);
+#endif
+#if PHY_DP83825_ENABLE_DP83825
+static status_t PHY_DP83825_InitRmii(phy_handle_t *handle, const phy_config_t *config);
+#endif
+#if PHY_DP83825_ENABLE_DP83826
+static status_t PHY_DP83826_Init(phy_handle_t *handle, const phy_config_t *config);
+#endif
+static void PHY_DP83825_WatchdogObserve(phy_handle_t *handle, status_t result, uint16_t bstatus);
+#if (PHY_DP83825_ENABLE_DP83826 && PHY_DP83825_ENABLE_EXT)
+static status_t PHY_DP83825_VodWrite(phy_handle_t *handle, const phy_dp83825_vod_t *vod);
+#endif
+static status_t PHY_DP83825_ShadowRead(phy_handle_t *handle, uint16_t *values);
 
 /*******************************************************************************
  * Variables
  ******************************************************************************/
-const phy_operations_t phydp83825_ops = {.phyInit             = PHY_DP83825_Init,
-                                         .phyWrite            = PHY_DP83825_Write,
-                                         .phyRead             = PHY_DP83825_Read,
-                                         .getAutoNegoStatus   = PHY_DP83825_GetAutoNegotiationStatus,
-                                         .getLinkStatus       = PHY_DP83825_GetLinkStatus,
-                                         .getLinkSpeedDuplex  = PHY_DP83825_GetLinkSpeedDuplex,
-                                         .setLinkSpeedDuplex  = PHY_DP83825_SetLinkSpeedDuplex,
-                                         .enableLoopback      = PHY_DP83825_EnableLoopback,
-                                         .enableLinkInterrupt = PHY_DP83825_EnableLinkInterrupt,
-                                         .clearInterrupt      = PHY_DP83825_ClearInterrupt};
+/*! @brief Operations shared by all variants, only the initialization differs. */
+#define PHY_DP83825_COMMON_OPS                                      \
+    .phyWrite            = PHY_DP83825_Write,                       \
+    .phyRead             = PHY_DP83825_Read,                        \
+    .getAutoNegoStatus   = PHY_DP83825_GetAutoNegotiationStatus,    \
+    .getLinkStatus       = PHY_DP83825_GetLinkStatus,               \
+    .getLinkSpeedDuplex  = PHY_DP83825_GetLinkSpeedDuplex,          \
+    .setLinkSpeedDuplex  = PHY_DP83825_SetLinkSpeedDuplex,          \
+    .enableLoopback      = PHY_DP83825_EnableLoopback,              \
+    .enableLinkInterrupt = PHY_DP83825_EnableLinkInterrupt,         \
+    .clearInterrupt      = PHY_DP83825_ClearInterrupt
+
+const phy_operations_t phydp83825_ops = {.phyInit = PHY_DP83825_Init, PHY_DP83825_COMMON_OPS};
+
+#if PHY_DP83825_ENABLE_DP83822
+static const phy_operations_t s_dp83822Ops = {.phyInit = PHY_DP83822_Init, PHY_DP83825_COMMON_OPS};
+#endif
+#if PHY_DP83825_ENABLE_DP83825
+static const phy_operations_t s_dp83825Ops = {.phyInit = PHY_DP83825_InitRmii, PHY_DP83825_COMMON_OPS};
+#endif
+#if PHY_DP83825_ENABLE_DP83826
+static const phy_operations_t s_dp83826Ops = {.phyInit = PHY_DP83826_Init, PHY_DP83825_COMMON_OPS};
+#endif
+
+/*! @brief Register scripts. */
+static const phy_dp83825_script_t s_resetScript[] = {
+    PHY_DP83825_SCRIPT_WRITE(PHY_BASICCONTROL_REG, PHY_BCTL_RESET_MASK),
+    /* Reset bits are self clearing, the PHY does not answer reliably before. */
+    PHY_DP83825_SCRIPT_WAIT(PHY_BASICCONTROL_REG, PHY_BCTL_RESET_MASK, 0U, PHY_RESET_TIMEOUT_MS),
+};
+
+#if PHY_DP83825_ENABLE_DP83822
+static const phy_dp83825_script_t s_dp83822InitScript[] = {
+    /* MII/RMII/RGMII mode comes from the straps, only set the elastic buffer. */
+    PHY_DP83825_SCRIPT_MODIFY(MII_DP83822_RCSR, DP83822_ELASTICBUF_MASK, DP83822_ELASTICBUF_14B),
+};
+#endif
+
+#if (PHY_DP83825_ENABLE_DP83825 || PHY_DP83825_ENABLE_DP83826)
+static const phy_dp83825_script_t s_rmiiInitScript[] = {
+    /* RMII configuration */
+    PHY_DP83825_SCRIPT_WRITE(MII_DP83822_RCSR, DP83822_RMII_MODE_SEL | DP83822_ELASTICBUF_14B),
+};
+#endif
+
+static const phy_dp83825_script_t s_initScript[] = {
+#if PHY_DP83825_ENABLE_EXT
+    /* Disable Wake on Lan. */
+    PHY_DP83825_SCRIPT_EXT_CLEAR(MII_DP83822_WOL_CFG, DP83822_WOL_EN | DP83822_WOL_MAGIC_EN | DP83822_WOL_SECURE_ON),
+#endif
+    /* Initialize AutoMDIX */
+    PHY_DP83825_SCRIPT_SET(MII_DP83822_PHYCR, DP83822_MDIX_AUTO_EN),
+};
+
+static const phy_dp83825_script_t s_autoNegScript[] = {
+    /* Set the auto-negotiation then start it. */
+    PHY_DP83825_SCRIPT_WRITE(PHY_AUTONEG_ADVERTISE_REG,
+                             PHY_100BASETX_FULLDUPLEX_MASK | PHY_100BASETX_HALFDUPLEX_MASK |
+                                 PHY_10BASETX_FULLDUPLEX_MASK | PHY_10BASETX_HALFDUPLEX_MASK |
+                                 PHY_IEEE802_3_SELECTOR_MASK),
+    PHY_DP83825_SCRIPT_WRITE(PHY_BASICCONTROL_REG, PHY_BCTL_AUTONEG_MASK | PHY_BCTL_RESTART_AUTONEG_MASK),
+};
+
+static const phy_dp83825_script_t s_fiberLinkScript[] = {
+    /* 100BASE-FX has no auto-negotiation, force the only mode there is. */
+    PHY_DP83825_SCRIPT_WRITE(PHY_AUTONEG_ADVERTISE_REG, MII_DP83822_FIBER_ADVERTISE),
+    PHY_DP83825_SCRIPT_MODIFY(PHY_BASICCONTROL_REG,
+                              PHY_BCTL_ISOLATE_MASK | PHY_BCTL_AUTONEG_MASK | PHY_BCTL_SPEED0_MASK |
+                                  PHY_BCTL_DUPLEX_MASK,
+                              PHY_BCTL_SPEED0_MASK | PHY_BCTL_DUPLEX_MASK),
+};
+
+static const phy_dp83825_script_t s_linkIntrEnableScript[] = {
+    PHY_DP83825_SCRIPT_SET(MII_DP83822_MISR1, DP83822_LINK_STAT_INT_EN),
+    PHY_DP83825_SCRIPT_SET(MII_DP83822_PHYSCR, DP83822_PHYSCR_INTEN | DP83822_PHYSCR_INT_OE),
+};
+
+static const phy_dp83825_script_t s_linkIntrDisableScript[] = {
+    PHY_DP83825_SCRIPT_CLEAR(MII_DP83822_MISR1, DP83822_LINK_STAT_INT_EN),
+    PHY_DP83825_SCRIPT_CLEAR(MII_DP83822_PHYSCR, DP83822_PHYSCR_INTEN | DP83822_PHYSCR_INT_OE),
+};
+
+static const phy_dp83825_script_t s_eeeIntrEnableScript[] = {
+    PHY_DP83825_SCRIPT_SET(MII_DP83822_MISR2, DP83822_EEE_ERROR_CHANGE_INT_EN),
+};
+
+static const phy_dp83825_script_t s_energyDetectEnableScript[] = {
+    PHY_DP83825_SCRIPT_SET(MII_DP83822_EDCR, DP83822_EDCR_ED_EN | DP83822_EDCR_ED_AUTO_UP | DP83822_EDCR_ED_AUTO_DOWN),
+    PHY_DP83825_SCRIPT_SET(MII_DP83822_MISR1, DP83822_ENERGY_DET_INT_EN),
+    PHY_DP83825_SCRIPT_SET(MII_DP83822_PHYSCR, DP83822_PHYSCR_INTEN | DP83822_PHYSCR_INT_OE),
+};
+
+static const phy_dp83825_script_t s_energyDetectDisableScript[] = {
+    PHY_DP83825_SCRIPT_CLEAR(MII_DP83822_EDCR,
+                             DP83822_EDCR_ED_EN | DP83822_EDCR_ED_AUTO_UP | DP83822_EDCR_ED_AUTO_DOWN),
+    PHY_DP83825_SCRIPT_CLEAR(MII_DP83822_MISR1, DP83822_ENERGY_DET_INT_EN),
+};
+
+#if PHY_DP83825_ENABLE_WOL
+static const phy_dp83825_script_t s_wolClearScript[] = {
+    PHY_DP83825_SCRIPT_EXT_SET(MII_DP83822_WOL_CFG, DP83822_WOL_CLR_INDICATION),
+};
+#endif
+
+static const phy_dp83825_script_t s_softResetScript[] = {
+    PHY_DP83825_SCRIPT_WRITE(MII_DP83822_RESET_CTRL, DP83822_SW_RESET),
+    PHY_DP83825_SCRIPT_WAIT(MII_DP83822_RESET_CTRL, DP83822_SW_RESET, 0U, PHY_RESET_TIMEOUT_MS),
+};
+
+static const phy_dp83825_script_t s_hardResetScript[] = {
+    PHY_DP83825_SCRIPT_WRITE(MII_DP83822_RESET_CTRL, DP83822_HW_RESET),
+    PHY_DP83825_SCRIPT_WAIT(MII_DP83822_RESET_CTRL, DP83822_HW_RESET, 0U, PHY_RESET_TIMEOUT_MS),
+};
+
+#define PHY_SCRIPT_COUNT(script) (sizeof(script) / sizeof((script)[0]))
+
+/*! @brief Variant capabilities, the features only some variants have. */
+#define PHY_DP83825_CAP_VOD   (1U << 0U) /*!< Transmit amplitude configuration, DP83826. */
+#define PHY_DP83825_CAP_FIBER (1U << 1U) /*!< 100BASE-FX fiber mode, DP83822. */
+
+/*! @brief Defines what the driver does differently per PHY variant. */
+typedef struct _phy_dp83825_variant_desc
+{
+    phy_dp83825_variant_t variant;      /*!< PHY variant. */
+    const phy_operations_t *ops;        /*!< Operations bound to the handle. */
+    const phy_dp83825_script_t *script; /*!< Variant specific initialization script. */
+    uint32_t count;                     /*!< Number of initialization script entries. */
+    uint32_t caps;                      /*!< Capabilities, PHY_DP83825_CAP_xxx. */
+} phy_dp83825_variant_desc_t;
+
+static const phy_dp83825_variant_desc_t s_variants[] = {
+#if PHY_DP83825_ENABLE_DP83822
+    {kPHY_DP83825_VariantDP83822, &s_dp83822Ops, s_dp83822InitScript, PHY_SCRIPT_COUNT(s_dp83822InitScript),
+     PHY_DP83825_CAP_FIBER},
+#endif
+#if PHY_DP83825_ENABLE_DP83825
+    {kPHY_DP83825_VariantDP83825, &s_dp83825Ops, s_rmiiInitScript, PHY_SCRIPT_COUNT(s_rmiiInitScript), 0U},
+#endif
+#if PHY_DP83825_ENABLE_DP83826
+    {kPHY_DP83825_VariantDP83826, &s_dp83826Ops, s_rmiiInitScript, PHY_SCRIPT_COUNT(s_rmiiInitScript),
+     PHY_DP83825_CAP_VOD},
+#endif
+};
+
+/*! @brief Shadowed configuration registers, in the order PHY_DP83825_ApplyConfig() writes them. */
+enum _phy_dp83825_shadow_index
+{
+    kPHY_DP83825_ShadowRcsr = 0U,
+    kPHY_DP83825_ShadowMisr1,
+    kPHY_DP83825_ShadowMisr2,
+    kPHY_DP83825_ShadowPhyscr,
+    kPHY_DP83825_ShadowPhycr,
+    kPHY_DP83825_ShadowAnar,
+    kPHY_DP83825_ShadowBiscr,
+    kPHY_DP83825_ShadowBmcr,
+};
+
+static const uint8_t s_shadowRegs[PHY_DP83825_SHADOW_COUNT] = {
+    MII_DP83822_RCSR,  MII_DP83822_MISR1,         MII_DP83822_MISR2, MII_DP83822_PHYSCR,
+    MII_DP83822_PHYCR, PHY_AUTONEG_ADVERTISE_REG, MII_DP83822_BISCR, PHY_BASICCONTROL_REG,
+};
+
+/*! @brief Self clearing and status bits, never kept in the shadow. */
+static const uint16_t s_shadowVolatile[PHY_DP83825_SHADOW_COUNT] = {
+    DP83822_RX_UNF_STS | DP83822_RX_OVF_STS,
+    0xFF00U,
+    0xFF00U,
+    0U,
+    0U,
+    0U,
+    DP83822_BISCR_PKT_GEN_BUSY | DP83822_BISCR_PRBS_LOCK | DP83822_BISCR_PRBS_SYNC_LOSS,
+    PHY_BCTL_RESET_MASK | PHY_BCTL_RESTART_AUTONEG_MASK,
+};
+
+/*! @brief BISCR loopback mode of each loopback point. */
+static const uint16_t s_loopbackBiscr[kPHY_DP83825_LoopbackCount] = {
+    0U,
+    0U,
+    DP83822_LOOPBACKMODE_REVERSE,
+    DP83822_LOOPBACKMODE_PCSIN,
+    DP83822_LOOPBACKMODE_PCSOUT,
+    DP83822_LOOPBACKMODE_DIGITAL,
+    DP83822_LOOPBACKMODE_ANALOG,
+};
 
 /*******************************************************************************
  * Code
  ******************************************************************************/
 
-status_t PHY_DP83825_Init(phy_handle_t *handle, const phy_config_t *config)
+static uint32_t PHY_DP83825_GetTimeUs(phy_handle_t *handle)
 {
-    int32_t counter  = PHY_READID_TIMEOUT_COUNT;
-    status_t result   = kStatus_Success;
-    uint16_t regValue = 0;
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
 
-    /* Assign PHY address and operation resource. */
-    handle->phyAddr  = config->phyAddr;
-    handle->resource = config->resource;
+    return (resource->getTimeUs != NULL) ? resource->getTimeUs() : 0U;
+}
 
-    /* Check PHY ID. */
-    do
-    {
-        uint32_t phyID;
-        result = PHY_DP83825_READ(handle, PHY_ID1_REG, &regValue);
-        if (result != kStatus_Success)
-        {
-            return result;
-        }
-        phyID = regValue << 16;
-        result = PHY_DP83825_READ(handle, PHY_ID2_REG, &regValue);
-        if (result != kStatus_Success)
-        {
-            return result;
-        }
-        phyID = (phyID | (regValue));
-        switch (phyID) {
-            case DP83822_PHY_ID:
-            case DP83825S_PHY_ID:
-            case DP83825I_PHY_ID:
-            case DP83825CM_PHY_ID:
-            case DP83825CS_PHY_ID:
-            case DP83826C_PHY_ID:
-            case DP83826NC_PHY_ID:
-                counter = -1;
-                break;
-            default:
-                counter--;
-                break;
-        }
-    } while (counter > 0);
+static void PHY_DP83825_BeginCall(phy_handle_t *handle)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
 
-    if (counter == 0U)
+    /* API functions called by the driver itself run under the deadline of the outer call. */
+    if (resource->callDepth == 0U)
     {
-        return kStatus_Fail;
+        resource->callStartUs = PHY_DP83825_GetTimeUs(handle);
     }
+}
 
-    /* Reset PHY. */
-    result = PHY_DP83825_WRITE(handle, PHY_BASICCONTROL_REG, PHY_BCTL_RESET_MASK);
-    if (result == kStatus_Success)
-    {
-        /* RMII configuration */
-        result = PHY_DP83825_WRITE(handle, MII_DP83822_RCSR, 
-            (DP83822_RMII_MODE_SEL|DP83822_ELASTICBUF_14B));
-        if (result != kStatus_Success)
-        {
-            return result;
-        }
-
-        /* Disable Wake on Lan. */
-        result = PHY_DP83825_EnableWakeOnLan(handle, config->intrType, false);
-        if (result != kStatus_Success)
-        {
-            return result;
-        }
-
-        /* Set PHY link status management interrupt. */
-        result = PHY_DP83825_EnableLinkInterrupt(handle, config->intrType, config->enableLinkIntr);
-        if (result != kStatus_Success)
-        {
-            return result;
-        }
-
-        /* Initialize AutoMDIX */
-        result = PHY_DP83825_EnableAutoMDIX(handle, config->intrType, true);
-        if (result != kStatus_Success)
-        {
-            return result;
-        }
-
-        if (config->autoNeg)
-        {
-            /* Set the auto-negotiation then start it. */
-            result = PHY_DP83825_WRITE(
-                handle, PHY_AUTONEG_ADVERTISE_REG,
-                (PHY_100BASETX_FULLDUPLEX_MASK | PHY_100BASETX_HALFDUPLEX_MASK | PHY_10BASETX_FULLDUPLEX_MASK |
-                 PHY_10BASETX_HALFDUPLEX_MASK | PHY_IEEE802_3_SELECTOR_MASK));
-            if (result == kStatus_Success)
-            {
-                result = PHY_DP83825_WRITE(handle, PHY_BASICCONTROL_REG,
-                                           (PHY_BCTL_AUTONEG_MASK | PHY_BCTL_RESTART_AUTONEG_MASK));
-            }
-        }
-        else
-        {
-            /* This PHY only supports 10/100M speed. */
-            assert(config->speed <= kPHY_Speed100M);
-
-            /* Disable isolate mode */
-            result = PHY_DP83825_READ(handle, PHY_BASICCONTROL_REG, &regValue);
-            if (result != kStatus_Success)
-            {
-                return result;
-            }
-            regValue &= ~PHY_BCTL_ISOLATE_MASK;
-            result = PHY_DP83825_WRITE(handle, PHY_BASICCONTROL_REG, regValue);
-            if (result != kStatus_Success)
-            {
-                return result;
-            }
+static void PHY_DP83825_RaiseEvent(phy_handle_t *handle, phy_dp83825_event_t event)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
 
-            /* Disable the auto-negotiation and set user-defined speed/duplex configuration. */
-            result = PHY_DP83825_SetLinkSpeedDuplex(handle, config->speed, config->duplex);
-        }
+    if (resource->eventCallback != NULL)
+    {
+        resource->eventCallback(handle, event, resource->eventUserData);
     }
-    return result;
 }
 
-status_t PHY_DP83825_Write(phy_handle_t *handle, uint8_t phyReg, uint16_t data)
+/*! @brief Time left until callDeadlineUs of the running API call, UINT32_MAX without a deadline. */
+static uint32_t PHY_DP83825_DeadlineRemaining(phy_handle_t *handle)
 {
-    return PHY_DP83825_WRITE(handle, phyReg, data);
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    uint32_t deadline                = resource->retryPolicy.callDeadlineUs;
+    uint32_t elapsed;
+
+    if ((deadline == 0U) || (resource->getTimeUs == NULL))
+    {
+        return UINT32_MAX;
+    }
+    elapsed = resource->getTimeUs() - resource->callStartUs;
+    return (elapsed >= deadline) ? 0U : (deadline - elapsed);
 }
 
-status_t PHY_DP83825_Read(phy_handle_t *handle, uint8_t phyReg, uint16_t *pData)
+static bool PHY_DP83825_DeadlineExpired(phy_handle_t *handle)
 {
-    return PHY_DP83825_READ(handle, phyReg, pData);
+    return PHY_DP83825_DeadlineRemaining(handle) == 0U;
 }
 
-status_t PHY_DP83825_GetAutoNegotiationStatus(phy_handle_t *handle, bool *status)
+static void PHY_DP83825_Delay(phy_handle_t *handle, uint32_t delayUs)
 {
-    assert(status);
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
 
-    status_t result;
-    uint16_t regValue;
+    if (resource->delayUs != NULL)
+    {
+        resource->delayUs(delayUs);
+    }
+    else
+    {
+        SDK_DelayAtLeastUs(delayUs, SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY);
+    }
+}
 
-    *status = false;
+static void PHY_DP83825_ShadowUpdate(phy_dp83825_resource_t *resource, uint8_t regAddr, uint16_t data, bool write)
+{
+    uint32_t index;
 
-    /* Check auto negotiation complete. */
-    result = PHY_DP83825_READ(handle, PHY_BASICSTATUS_REG, &regValue);
-    if (result == kStatus_Success)
+    /* MISR status bits clear on read, keep the ones other calls ask for. */
+    if (!write && (regAddr == MII_DP83822_MISR1))
     {
-        if ((regValue & PHY_BSTATUS_AUTONEGCOMP_MASK) != 0U)
+        resource->misr1Latched |= data & DP83822_ENERGY_DET_INT;
+    }
+    if (!write && (regAddr == MII_DP83822_MISR2))
+    {
+        resource->misr2Latched |= data & DP83822_WOL_PKT_INT;
+        if ((data & DP83822_EEE_ERROR_CHANGE_INT) != 0U)
         {
-            *status = true;
+            resource->eeeErrorEvents++;
         }
     }
-    return result;
-}
 
-status_t PHY_DP83825_GetLinkStatus(phy_handle_t *handle, bool *status)
-{
-    assert(status);
+    /* The error counters clear on read too, keep totals every user can take deltas of. */
+    if (!write && (regAddr == MII_DP83822_FCSCR))
+    {
+        resource->falseCarriers += FIELD_GET(DP83822_FCSCR_FCSCNT_MASK, data);
+    }
+    if (!write && (regAddr == MII_DP83822_RECR))
+    {
+        resource->rxErrors += data;
+    }
 
-    status_t result;
-    uint16_t regValue;
+    /* Resets return the registers to their strap defaults. */
+    if (write && (((regAddr == PHY_BASICCONTROL_REG) && ((data & PHY_BCTL_RESET_MASK) != 0U)) ||
+                  ((regAddr == MII_DP83822_RESET_CTRL) && ((data & (DP83822_HW_RESET | DP83822_SW_RESET)) != 0U))))
+    {
+        resource->shadow.valid = 0U;
+        return;
+    }
 
-    /* Read the basic status register. */
-    result = PHY_DP83825_READ(handle, PHY_BASICSTATUS_REG, &regValue);
-    if (result == kStatus_Success)
+    for (index = 0U; index < PHY_DP83825_SHADOW_COUNT; index++)
     {
-        if ((PHY_BSTATUS_LINKSTATUS_MASK & regValue) != 0U)
-        {
-            /* Link up. */
-            *status = true;
-        }
-        else
+        if (s_shadowRegs[index] == regAddr)
         {
-            /* Link down. */
-            *status = false;
+            resource->shadow.value[index] = data & (uint16_t)~s_shadowVolatile[index];
+            resource->shadow.valid |= (uint16_t)(1U << index);
+            break;
         }
     }
-    return result;
 }
 
-status_t PHY_DP83825_GetLinkSpeedDuplex(phy_handle_t *handle, phy_speed_t *speed, phy_duplex_t *duplex)
+#if PHY_DP83825_ENABLE_TELEMETRY
+static void PHY_DP83825_PhaseStart(phy_handle_t *handle)
 {
-    assert(!((speed == NULL) && (duplex == NULL)));
+    phy_dp83825_timeline_t *timeline = &((phy_dp83825_resource_t *)handle->resource)->timing.timeline;
 
-    status_t result;
-    uint16_t regValue;
+    timeline->startUs = PHY_DP83825_GetTimeUs(handle);
+    timeline->reached = 0U;
+}
 
-    /* Read the control register. */
-    result = PHY_DP83825_READ(handle, MII_DP83822_PHYSTS, &regValue);
-    if (result == kStatus_Success)
+static void PHY_DP83825_PhaseMark(phy_handle_t *handle, phy_dp83825_phase_t phase)
+{
+    phy_dp83825_link_timing_t *timing = &((phy_dp83825_resource_t *)handle->resource)->timing;
+    uint32_t now                      = PHY_DP83825_GetTimeUs(handle);
+    uint32_t index;
+
+    timing->timeline.phaseUs[phase] = now - timing->timeline.startUs;
+    timing->timeline.reached |= (uint16_t)(1U << phase);
+    if (phase != kPHY_DP83825_PhaseResolved)
     {
-        if (speed != NULL)
+        return;
+    }
+
+    /* Bring-up complete, aggregate the phases it went through. */
+    timing->stats.linkUps++;
+    for (index = 0U; index < (uint32_t)kPHY_DP83825_PhaseCount; index++)
+    {
+        uint32_t phaseUs = timing->timeline.phaseUs[index];
+
+        if ((timing->timeline.reached & (1U << index)) == 0U)
         {
-            if (regValue & DP83822_PHYSTS_10)
-            {
-                *speed = kPHY_Speed10M;
-            }
-            else
-            {
-                *speed = kPHY_Speed100M;
-            }
+            continue;
         }
-
-        if (duplex != NULL)
+        if ((timing->stats.count[index] == 0U) || (phaseUs < timing->stats.minUs[index]))
         {
-            if (regValue & DP83822_PHYSTS_DUPLEX)
-            {
-                *duplex = kPHY_FullDuplex;
-            }
-            else
-            {
-                *duplex = kPHY_HalfDuplex;
-            }
+            timing->stats.minUs[index] = phaseUs;
+        }
+        if (phaseUs > timing->stats.maxUs[index])
+        {
+            timing->stats.maxUs[index] = phaseUs;
         }
+        timing->stats.count[index]++;
+        timing->totalUs[index] += phaseUs;
     }
-    return result;
 }
 
-status_t PHY_DP83825_SetLinkSpeedDuplex(phy_handle_t *handle, phy_speed_t speed, phy_duplex_t duplex)
+static void PHY_DP83825_PhaseUpdate(phy_handle_t *handle, uint8_t regAddr, uint16_t data, bool write)
 {
-    /* This PHY only supports 10/100M speed. */
-    assert(speed <= kPHY_Speed100M);
+    phy_dp83825_timeline_t *timeline = &((phy_dp83825_resource_t *)handle->resource)->timing.timeline;
+    phy_dp83825_phase_t phase;
 
-    status_t result;
-    uint16_t regValue;
-
-    result = PHY_DP83825_READ(handle, PHY_BASICCONTROL_REG, &regValue);
-    if (result == kStatus_Success)
+    if (write)
     {
-        /* Disable the auto-negotiation and set according to user-defined configuration. */
-        regValue &= ~PHY_BCTL_AUTONEG_MASK;
-        if (speed == kPHY_Speed100M)
+        if (((regAddr == PHY_BASICCONTROL_REG) && ((data & PHY_BCTL_RESET_MASK) != 0U)) ||
+            ((regAddr == MII_DP83822_RESET_CTRL) && ((data & (DP83822_HW_RESET | DP83822_SW_RESET)) != 0U)))
         {
-            regValue |= PHY_BCTL_SPEED0_MASK;
+            phase = kPHY_DP83825_PhaseResetIssued;
         }
-        else
+        else if ((regAddr == PHY_BASICCONTROL_REG) && ((data & PHY_BCTL_RESTART_AUTONEG_MASK) != 0U))
         {
-            regValue &= ~PHY_BCTL_SPEED0_MASK;
+            phase = kPHY_DP83825_PhaseAutoNegRestart;
         }
-        if (duplex == kPHY_FullDuplex)
+        else
         {
-            regValue |= PHY_BCTL_DUPLEX_MASK;
+            return;
         }
-        else
+        /* Going back to an earlier phase starts a new bring-up. */
+        if ((timeline->reached & (uint16_t)~((1U << phase) - 1U)) != 0U)
         {
-            regValue &= ~PHY_BCTL_DUPLEX_MASK;
+            PHY_DP83825_PhaseStart(handle);
         }
-        result = PHY_DP83825_WRITE(handle, PHY_BASICCONTROL_REG, regValue);
+        PHY_DP83825_PhaseMark(handle, phase);
+        return;
     }
-    return result;
-}
-
-status_t PHY_DP83825_EnableLoopback(phy_handle_t *handle, phy_loop_t mode, phy_speed_t speed, bool enable)
-{
-    /* This PHY only supports local/remote loopback and 10/100M speed. */
-    assert(mode <= kPHY_RemoteLoop);
-    assert(speed <= kPHY_Speed100M);
 
-    status_t result;
-    uint16_t regValue;
-
-    /* Set the loop mode. */
-    if (enable)
+    switch (regAddr)
     {
-        if (mode == kPHY_LocalLoop)
-        {
-            if (speed == kPHY_Speed100M)
+        case PHY_BASICCONTROL_REG:
+            if (((timeline->reached & (1U << kPHY_DP83825_PhaseResetIssued)) != 0U) &&
+                ((timeline->reached & (1U << kPHY_DP83825_PhaseResetDone)) == 0U) &&
+                ((data & PHY_BCTL_RESET_MASK) == 0U))
             {
-                regValue = PHY_BCTL_SPEED0_MASK | PHY_BCTL_DUPLEX_MASK | PHY_BCTL_LOOP_MASK;
+                PHY_DP83825_PhaseMark(handle, kPHY_DP83825_PhaseResetDone);
             }
-            else
+            break;
+        case PHY_BASICSTATUS_REG:
+            if ((data & PHY_BSTATUS_LINKSTATUS_MASK) == 0U)
             {
-                regValue = PHY_BCTL_DUPLEX_MASK | PHY_BCTL_LOOP_MASK;
+                if ((timeline->reached & (1U << kPHY_DP83825_PhaseLinkUp)) != 0U)
+                {
+                    /* Link lost, time the way back up. */
+                    PHY_DP83825_PhaseStart(handle);
+                    break;
+                }
             }
-            return PHY_DP83825_WRITE(handle, PHY_BASICCONTROL_REG, regValue);
-        }
-        else
-        {
-            /* Remote loopback only supports 100M full-duplex. */
-            assert(speed == kPHY_Speed100M);
-
-            regValue = PHY_BCTL_SPEED0_MASK | PHY_BCTL_DUPLEX_MASK | PHY_BCTL_LOOP_MASK;
-            result   = PHY_DP83825_WRITE(handle, PHY_BASICCONTROL_REG, regValue);
-            if (result != kStatus_Success)
+            else if ((timeline->reached & (1U << kPHY_DP83825_PhaseLinkUp)) == 0U)
             {
-                return result;
+                PHY_DP83825_PhaseMark(handle, kPHY_DP83825_PhaseLinkUp);
             }
-            /* Set the remote loopback bit. */
-            result = PHY_DP83825_READ(handle, MII_DP83822_BISCR, &regValue);
-            if (result == kStatus_Success)
+            if (((data & PHY_BSTATUS_AUTONEGCOMP_MASK) != 0U) &&
+                ((timeline->reached & (1U << kPHY_DP83825_PhaseAutoNegComplete)) == 0U))
             {
-                regValue &= ~DP83822_BISCR_LOOPBACKMODE_MASK;
-                regValue |= DP83822_LOOPBACKMODE_REVERSE;
-                return PHY_DP83825_WRITE(handle, MII_DP83822_BISCR, regValue);
+                PHY_DP83825_PhaseMark(handle, kPHY_DP83825_PhaseAutoNegComplete);
             }
-        }
+            break;
+        case MII_DP83822_PHYSTS:
+            if (((data & DP83822_PHYSTS_LINK) != 0U) &&
+                ((timeline->reached & (1U << kPHY_DP83825_PhaseLinkUp)) != 0U) &&
+                ((timeline->reached & (1U << kPHY_DP83825_PhaseResolved)) == 0U))
+            {
+                PHY_DP83825_PhaseMark(handle, kPHY_DP83825_PhaseResolved);
+            }
+            break;
+        default:
+            break;
     }
-    else
+}
+#else
+#define PHY_DP83825_PhaseStart(handle)
+#define PHY_DP83825_PhaseMark(handle, phase)
+#define PHY_DP83825_PhaseUpdate(handle, regAddr, data, write)
+#endif
+
+static status_t PHY_DP83825_Mdio(
+    phy_handle_t *handle, phy_dp83825_mdio_op_t op, uint8_t devAddr, uint16_t regAddr, uint16_t *data)
+{
+    phy_dp83825_resource_t *resource   = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_retry_policy_t *policy = &resource->retryPolicy;
+    const phy_dp83825_bus_t *bus       = resource->bus;
+    uint32_t maxBackoff                = (policy->maxBackoffUs != 0U) ? policy->maxBackoffUs : UINT32_MAX;
+    uint32_t backoff                   = (policy->backoffUs < maxBackoff) ? policy->backoffUs : maxBackoff;
+    uint8_t attempt                    = 0U;
+    status_t result;
+    uint32_t start;
+    uint32_t remaining;
+
+    for (;;)
     {
-        /* Disable the loop mode. */
-        if (mode == kPHY_LocalLoop)
+        start = PHY_DP83825_GetTimeUs(handle);
+        resource->retryStats.frames++;
+        if (bus == NULL)
         {
-            /* First read the current status in control register. */
-            result = PHY_DP83825_READ(handle, PHY_BASICCONTROL_REG, &regValue);
-            if (result == kStatus_Success)
+            switch (op)
             {
-                regValue &= ~PHY_BCTL_LOOP_MASK;
-                return PHY_DP83825_WRITE(handle, PHY_BASICCONTROL_REG, (regValue | PHY_BCTL_RESTART_AUTONEG_MASK));
+                case kPHY_DP83825_MdioWrite:
+                    result = resource->write(handle->phyAddr, (uint8_t)regAddr, *data);
+                    break;
+                case kPHY_DP83825_MdioRead:
+                    result = resource->read(handle->phyAddr, (uint8_t)regAddr, data);
+                    break;
+                case kPHY_DP83825_MdioWriteExt:
+                    result = resource->writeExt(handle->phyAddr, devAddr, regAddr, *data);
+                    break;
+                default:
+                    result = resource->readExt(handle->phyAddr, devAddr, regAddr, data);
+                    break;
             }
         }
         else
         {
-            /* Clear the remote loopback bit. */
-            result = PHY_DP83825_READ(handle, MII_DP83822_BISCR, &regValue);
-            if (result == kStatus_Success)
+            if (bus->lock != NULL)
+            {
+                bus->lock(bus->lockContext);
+            }
+            switch (op)
+            {
+                case kPHY_DP83825_MdioWrite:
+                    result = bus->write(bus->context, handle->phyAddr, (uint8_t)regAddr, *data);
+                    break;
+                case kPHY_DP83825_MdioRead:
+                    result = bus->read(bus->context, handle->phyAddr, (uint8_t)regAddr, data);
+                    break;
+                case kPHY_DP83825_MdioWriteExt:
+                    result = bus->writeExt(bus->context, handle->phyAddr, devAddr, regAddr, *data);
+                    break;
+                default:
+                    result = bus->readExt(bus->context, handle->phyAddr, devAddr, regAddr, data);
+                    break;
+            }
+            if (bus->unlock != NULL)
             {
-                regValue &= ~DP83822_BISCR_LOOPBACKMODE_MASK;
-                return PHY_DP83825_WRITE(handle, MII_DP83822_BISCR, regValue);
+                bus->unlock(bus->lockContext);
             }
         }
-    }
-    return result;
-}
 
-status_t PHY_DP83825_EnableAutoMDIX(phy_handle_t *handle, phy_interrupt_type_t type, bool enable)
-{
-    status_t result;
-    uint16_t regValue;
+        if ((result == kStatus_Success) && (policy->opTimeoutUs != 0U) &&
+            ((PHY_DP83825_GetTimeUs(handle) - start) > policy->opTimeoutUs))
+        {
+            /* Slow turnaround, the answer can not be trusted. */
+            result = kStatus_Timeout;
+        }
+        if ((result == kStatus_Success) && policy->retryStuckHigh &&
+            ((op == kPHY_DP83825_MdioRead) || (op == kPHY_DP83825_MdioReadExt)) && (*data == 0xFFFFU))
+        {
+            result = kStatus_Fail;
+        }
+        PHY_DP83825_TRACE(handle->phyAddr, (uint8_t)op, devAddr, regAddr, *data, result, start,
+                          PHY_DP83825_GetTimeUs(handle));
+        if (result == kStatus_Success)
+        {
+            if ((op == kPHY_DP83825_MdioWrite) || (op == kPHY_DP83825_MdioRead))
+            {
+                PHY_DP83825_ShadowUpdate(resource, (uint8_t)regAddr, *data, op == kPHY_DP83825_MdioWrite);
+                PHY_DP83825_PhaseUpdate(handle, (uint8_t)regAddr, *data, op == kPHY_DP83825_MdioWrite);
+            }
+            return result;
+        }
+        if (result == kStatus_Timeout)
+        {
+            resource->retryStats.timeouts++;
+        }
 
-    result = PHY_DP83825_READ(handle, MII_DP83822_PHYCR, &regValue);
-    if (result == kStatus_Success)
-    {
-        /* Enable/Disable Auto MDI/X. */
-        if (enable)
+        if (attempt >= policy->maxRetries)
         {
-            regValue |= DP83822_MDIX_AUTO_EN;
+            break;
         }
-        else
+        remaining = PHY_DP83825_DeadlineRemaining(handle);
+        if (remaining == 0U)
+        {
+            resource->retryStats.deadlines++;
+            break;
+        }
+        if (backoff != 0U)
         {
-            // TODO: Implement
-            return kStatus_InvalidArgument;
+            /* Never sleep past the deadline, and saturate the doubling instead of wrapping to 0. */
+            PHY_DP83825_Delay(handle, (backoff < remaining) ? backoff : remaining);
+            backoff = (backoff > (maxBackoff >> 1U)) ? maxBackoff : (backoff << 1U);
         }
-        result = PHY_DP83825_WRITE(handle, MII_DP83822_MISR1, regValue);
+        attempt++;
+        resource->retryStats.retries++;
     }
-    if (result != kStatus_Success)
-    {
-        return result;
-    } 
+
+    resource->retryStats.failures++;
+    return result;
 }
 
-status_t PHY_DP83825_EnableWakeOnLan(phy_handle_t *handle, phy_interrupt_type_t type, bool enable)
+static status_t PHY_DP83825_ReadId(phy_handle_t *handle, uint32_t *phyID)
 {
     status_t result;
     uint16_t regValue;
 
-    result = PHY_DP83825_EXTREAD(handle, DP83822_DEVADDR, MII_DP83822_WOL_CFG, &regValue);
-    if (result == kStatus_Success)
+    result = PHY_DP83825_READ(handle, PHY_ID1_REG, &regValue);
+    if (result != kStatus_Success)
     {
-        /* Enable/Disable Wake on lan. */
-        if (enable)
-        {
-            // TODO: Implement
-            return kStatus_InvalidArgument;
-        }
-        else
-        {
-            regValue &= ~(DP83822_WOL_EN|DP83822_WOL_MAGIC_EN|DP83822_WOL_SECURE_ON);
-        }
-        result = PHY_DP83825_EXTWRITE(handle, DP83822_DEVADDR, MII_DP83822_MISR1, regValue);
+        return result;
     }
+    *phyID = (uint32_t)regValue << 16;
+    result = PHY_DP83825_READ(handle, PHY_ID2_REG, &regValue);
     if (result != kStatus_Success)
     {
         return result;
     }
+    *phyID |= regValue;
+    return result;
 }
 
-status_t PHY_DP83825_EnableLinkInterrupt(phy_handle_t *handle, phy_interrupt_type_t type, bool enable)
+static phy_dp83825_variant_t PHY_DP83825_VariantFromId(uint32_t phyID)
+{
+    switch (phyID) {
+        case DP83822_PHY_ID:
+            return kPHY_DP83825_VariantDP83822;
+        case DP83825S_PHY_ID:
+        case DP83825I_PHY_ID:
+        case DP83825CM_PHY_ID:
+        case DP83825CS_PHY_ID:
+            return kPHY_DP83825_VariantDP83825;
+        case DP83826C_PHY_ID:
+        case DP83826NC_PHY_ID:
+            return kPHY_DP83825_VariantDP83826;
+        default:
+            return kPHY_DP83825_VariantUnknown;
+    }
+}
+
+static const phy_dp83825_variant_desc_t *PHY_DP83825_GetVariantDesc(phy_dp83825_variant_t variant)
+{
+    uint32_t index;
+
+    for (index = 0U; index < PHY_SCRIPT_COUNT(s_variants); index++)
+    {
+        if (s_variants[index].variant == variant)
+        {
+            return &s_variants[index];
+        }
+    }
+    /* Variant not supported by this build. */
+    return NULL;
+}
+
+#if PHY_DP83825_ENABLE_EXT
+static bool PHY_DP83825_HasCap(phy_handle_t *handle, uint32_t cap)
+{
+    const phy_dp83825_variant_desc_t *desc =
+        PHY_DP83825_GetVariantDesc(((phy_dp83825_resource_t *)handle->resource)->variant);
+
+    /* Nothing is known of a PHY before PHY_DP83825_Init(). */
+    return (desc != NULL) && ((desc->caps & cap) != 0U);
+}
+#endif
+
+static status_t PHY_DP83825_InitVariant(phy_handle_t *handle,
+                                        const phy_config_t *config,
+                                        phy_dp83825_variant_t required)
+{
+    const phy_dp83825_variant_desc_t *desc = NULL;
+    phy_dp83825_resource_t *resource;
+    int32_t counter = PHY_READID_TIMEOUT_COUNT;
+    status_t result = kStatus_Success;
+    uint32_t phyID  = 0U;
+
+    /* Assign PHY address and operation resource. */
+    handle->phyAddr  = config->phyAddr;
+    handle->resource = config->resource;
+    resource         = (phy_dp83825_resource_t *)handle->resource;
+    PHY_DP83825_BeginCall(handle);
+    PHY_DP83825_PhaseStart(handle);
+
+    /* Check PHY ID. */
+    do
+    {
+        result = PHY_DP83825_ReadId(handle, &phyID);
+        if (result != kStatus_Success)
+        {
+            return result;
+        }
+        if (PHY_DP83825_DeadlineExpired(handle))
+        {
+            resource->retryStats.deadlines++;
+            return kStatus_Timeout;
+        }
+        desc = PHY_DP83825_GetVariantDesc(PHY_DP83825_VariantFromId(phyID));
+        counter--;
+    } while ((desc == NULL) && (counter > 0));
+
+    if ((desc == NULL) || ((required != kPHY_DP83825_VariantUnknown) && (desc->variant != required)))
+    {
+        return kStatus_Fail;
+    }
+    PHY_DP83825_PhaseMark(handle, kPHY_DP83825_PhaseIdRead);
+
+    /* Bind the operations of the detected variant. */
+    handle->ops       = desc->ops;
+    resource->variant = desc->variant;
+
+    /* Remember the PHY and its configuration for the watchdog recovery. */
+    resource->phyId                 = phyID;
+    resource->config                = *config;
+    resource->watchdog.hang         = kPHY_DP83825_HangNone;
+    resource->watchdog.busErrors    = 0U;
+    resource->watchdog.autoNegPolls = 0U;
+    resource->watchdog.verifyPolls  = 0U;
+    (void)memset(&resource->energy, 0, sizeof(resource->energy));
+#if PHY_DP83825_ENABLE_DIAGNOSTICS
+    (void)memset(&resource->bist, 0, sizeof(resource->bist));
+    resource->cable.state = (uint8_t)kPHY_DP83825_CableIdle;
+#endif
+    resource->linkUp = false;
+
+    resource->callDepth++;
+    result = PHY_DP83825_Configure(handle, config, true);
+    resource->callDepth--;
+    return result;
+}
+
+status_t PHY_DP83825_Init(phy_handle_t *handle, const phy_config_t *config)
+{
+    return PHY_DP83825_InitVariant(handle, config, kPHY_DP83825_VariantUnknown);
+}
+
+#if PHY_DP83825_ENABLE_DP83822
+static status_t PHY_DP83822_Init(phy_handle_t *handle, const phy_config_t *config)
+{
+    return PHY_DP83825_InitVariant(handle, config, kPHY_DP83825_VariantDP83822);
+}
+#endif
+
+#if PHY_DP83825_ENABLE_DP83825
+static status_t PHY_DP83825_InitRmii(phy_handle_t *handle, const phy_config_t *config)
+{
+    return PHY_DP83825_InitVariant(handle, config, kPHY_DP83825_VariantDP83825);
+}
+#endif
+
+#if PHY_DP83825_ENABLE_DP83826
+static status_t PHY_DP83826_Init(phy_handle_t *handle, const phy_config_t *config)
+{
+    return PHY_DP83825_InitVariant(handle, config, kPHY_DP83825_VariantDP83826);
+}
+#endif
+
+bool PHY_DP83825_IsFiber(phy_handle_t *handle)
+{
+    return ((phy_dp83825_resource_t *)handle->resource)->fiber;
+}
+
+phy_dp83825_variant_t PHY_DP83825_GetVariant(phy_handle_t *handle)
+{
+    return ((phy_dp83825_resource_t *)handle->resource)->variant;
+}
+
+static status_t PHY_DP83825_RestartAutoNeg(phy_handle_t *handle)
+{
+    uint16_t regValue;
+    status_t result;
+
+    /* Forced links have nothing to renegotiate. */
+    result = PHY_DP83825_READ(handle, PHY_BASICCONTROL_REG, &regValue);
+    if ((result == kStatus_Success) && ((regValue & PHY_BCTL_AUTONEG_MASK) != 0U))
+    {
+        result = PHY_DP83825_WRITE(handle, PHY_BASICCONTROL_REG, regValue | PHY_BCTL_RESTART_AUTONEG_MASK);
+    }
+    return result;
+}
+
+#if PHY_DP83825_ENABLE_EXT
+static status_t PHY_DP83825_EeeAdvertise(phy_handle_t *handle, bool enable, bool *changed)
+{
+    uint16_t regValue;
+    uint16_t target;
+    status_t result;
+
+    result = PHY_DP83825_EXTREAD(handle, DP83822_MMD_AN, MII_DP83822_EEE_ADV, &regValue);
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+    target = (uint16_t)FIELD_MODIFY(DP83822_EEE_100TX, regValue, enable);
+    if (changed != NULL)
+    {
+        *changed = (target != regValue);
+    }
+    if (target == regValue)
+    {
+        return result;
+    }
+    return PHY_DP83825_EXTWRITE(handle, DP83822_MMD_AN, MII_DP83822_EEE_ADV, target);
+}
+#endif
+
+#if (PHY_DP83825_ENABLE_DP83822 && PHY_DP83825_ENABLE_EXT)
+static status_t PHY_DP83825_FiberSetup(phy_handle_t *handle)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_script_t script[2];
+    uint32_t count    = 0U;
+    uint16_t regValue = 0U;
+    status_t result   = kStatus_Success;
+    uint16_t strap;
+
+    resource->fiber = false;
+    if (!PHY_DP83825_HasCap(handle, PHY_DP83825_CAP_FIBER))
+    {
+        return (resource->fiberMode == kPHY_DP83825_FiberOn) ? kStatus_InvalidArgument : kStatus_Success;
+    }
+
+    if (resource->fiberMode == kPHY_DP83825_FiberStrap)
+    {
+        /* The strap already selected the mode, it only has to be known. */
+        /* Modes 2 and 3 of the COL strap select 100BASE-FX. */
+        result          = PHY_DP83825_EXTREAD(handle, DP83822_DEVADDR, MII_DP83822_SOR1, &regValue);
+        strap           = (uint16_t)FIELD_GET(DP83822_COL_STRAP_MASK, regValue);
+        resource->fiber = (strap == DP83822_STRAP_MODE2) || (strap == DP83822_STRAP_MODE3);
+    }
+    else
+    {
+        resource->fiber = (resource->fiberMode == kPHY_DP83825_FiberOn);
+        script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_MODIFY(
+            MII_DP83822_CTRL_2, DP83822_FX_ENABLE, resource->fiber ? DP83822_FX_ENABLE : 0U);
+    }
+
+    /* A wrong polarity reads a dark fiber as signal present. */
+    if (resource->fiber && (resource->fiberSigDet != kPHY_DP83825_SigDetStrap))
+    {
+        script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_EXT_MODIFY(
+            MII_DP83822_GENCFG, DP83822_SIG_DET_LOW,
+            (resource->fiberSigDet == kPHY_DP83825_SigDetLow) ? DP83822_SIG_DET_LOW : 0U);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_RunScript(handle, script, count);
+    }
+    return result;
+}
+#else
+static status_t PHY_DP83825_FiberSetup(phy_handle_t *handle)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+
+    /* 100BASE-FX is a DP83822 mode, set up through the extended registers. */
+    resource->fiber = false;
+    return (resource->fiberMode == kPHY_DP83825_FiberOn) ? kStatus_InvalidArgument : kStatus_Success;
+}
+#endif
+
+static status_t PHY_DP83825_Configure(phy_handle_t *handle, const phy_config_t *config, bool reset)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    const phy_dp83825_variant_desc_t *desc;
+    status_t result = kStatus_Success;
+
+    if (reset)
+    {
+        /* Reset PHY and wait until it answers again. */
+        result = PHY_DP83825_RunScript(handle, s_resetScript, PHY_SCRIPT_COUNT(s_resetScript));
+        if (result != kStatus_Success)
+        {
+            return result;
+        }
+    }
+
+    desc   = PHY_DP83825_GetVariantDesc(resource->variant);
+    result = PHY_DP83825_RunScript(handle, desc->script, desc->count);
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_RunScript(handle, s_initScript, PHY_SCRIPT_COUNT(s_initScript));
+    }
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+    /* The script left the applied RCSR value in the shadow, the watchdog checks against it. */
+    resource->rcsr = resource->shadow.value[kPHY_DP83825_ShadowRcsr];
+
+    result = PHY_DP83825_FiberSetup(handle);
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+    if (resource->fiber)
+    {
+        /* Keeps the watchdog from waiting for an auto-negotiation that never runs. */
+        resource->config.autoNeg = false;
+    }
+
+    /* Set PHY link status management interrupt. */
+    result = PHY_DP83825_EnableLinkInterrupt(handle, config->intrType, config->enableLinkIntr);
+    if ((result == kStatus_Success) && config->enableEEE && config->enableLinkIntr)
+    {
+        result = PHY_DP83825_RunScript(handle, s_eeeIntrEnableScript, PHY_SCRIPT_COUNT(s_eeeIntrEnableScript));
+    }
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+
+    if ((result == kStatus_Success) && resource->energy.enabled && !resource->fiber)
+    {
+        result = PHY_DP83825_RunScript(handle, s_energyDetectEnableScript,
+                                       PHY_SCRIPT_COUNT(s_energyDetectEnableScript));
+    }
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+
+#if (PHY_DP83825_ENABLE_DP83826 && PHY_DP83825_ENABLE_EXT)
+    /* The reset restored the default transmit amplitude. */
+    if (resource->vod.valid)
+    {
+        result = PHY_DP83825_VodWrite(handle, &resource->vod.setting);
+    }
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+#endif
+
+#if PHY_DP83825_ENABLE_EXT
+    /* The EEE advertisement is picked up by the auto-negotiation below. */
+    result = PHY_DP83825_EeeAdvertise(handle, config->enableEEE, NULL);
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+#endif
+
+    if (resource->fiber)
+    {
+        result = PHY_DP83825_RunScript(handle, s_fiberLinkScript, PHY_SCRIPT_COUNT(s_fiberLinkScript));
+    }
+    else if (config->autoNeg)
+    {
+        result = PHY_DP83825_RunScript(handle, s_autoNegScript, PHY_SCRIPT_COUNT(s_autoNegScript));
+    }
+    else
+    {
+        /* This PHY only supports 10/100M speed. */
+        assert(config->speed <= kPHY_Speed100M);
+
+        /* Disable isolate mode, disable the auto-negotiation and set user-defined speed/duplex configuration. */
+        phy_dp83825_script_t forced[] = {
+            PHY_DP83825_SCRIPT_CLEAR(PHY_BASICCONTROL_REG, PHY_BCTL_ISOLATE_MASK),
+            PHY_DP83825_SCRIPT_MODIFY(PHY_BASICCONTROL_REG,
+                                      PHY_BCTL_AUTONEG_MASK | PHY_BCTL_SPEED0_MASK | PHY_BCTL_DUPLEX_MASK,
+                                      ((config->speed == kPHY_Speed100M) ? PHY_BCTL_SPEED0_MASK : 0U) |
+                                          ((config->duplex == kPHY_FullDuplex) ? PHY_BCTL_DUPLEX_MASK : 0U)),
+        };
+        result = PHY_DP83825_RunScript(handle, forced, PHY_SCRIPT_COUNT(forced));
+    }
+    return result;
+}
+
+status_t PHY_DP83825_Write(phy_handle_t *handle, uint8_t phyReg, uint16_t data)
+{
+    PHY_DP83825_BeginCall(handle);
+
+    return PHY_DP83825_WRITE(handle, phyReg, data);
+}
+
+status_t PHY_DP83825_Read(phy_handle_t *handle, uint8_t phyReg, uint16_t *pData)
+{
+    PHY_DP83825_BeginCall(handle);
+
+    return PHY_DP83825_READ(handle, phyReg, pData);
+}
+
+static status_t PHY_DP83825_EnergyDetectWake(phy_handle_t *handle)
+{
+    phy_dp83825_energy_detect_t *energy = &((phy_dp83825_resource_t *)handle->resource)->energy;
+    uint32_t now                        = PHY_DP83825_GetTimeUs(handle);
+
+    energy->poweredDown           = false;
+    energy->waking                = true;
+    energy->wakeUs                = now;
+    energy->stats.lastResidencyUs = now - energy->downStartUs;
+    energy->stats.residencyUs += energy->stats.lastResidencyUs;
+    energy->stats.wakeups++;
+
+    /* Cable inserted, negotiate right away instead of waiting for the PHY to retry. */
+    PHY_DP83825_PhaseStart(handle);
+    return PHY_DP83825_RestartAutoNeg(handle);
+}
+
+static status_t PHY_DP83825_EnergyDetectPoll(phy_handle_t *handle)
+{
+    phy_dp83825_resource_t *resource    = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_energy_detect_t *energy = &resource->energy;
+    uint16_t regValue;
+    status_t result;
+
+    if ((resource->misr1Latched & DP83822_ENERGY_DET_INT) == 0U)
+    {
+        if ((energy->idlePolls == 0U) || (++energy->pollCount < energy->idlePolls))
+        {
+            return kStatus_Success;
+        }
+        energy->pollCount = 0U;
+        result            = PHY_DP83825_READ(handle, MII_DP83822_EDCR, &regValue);
+        if ((result != kStatus_Success) || ((regValue & DP83822_EDCR_ED_PWR_STATE) == 0U))
+        {
+            return result;
+        }
+    }
+    resource->misr1Latched &= (uint16_t)~DP83822_ENERGY_DET_INT;
+    return PHY_DP83825_EnergyDetectWake(handle);
+}
+
+static status_t PHY_DP83825_EnergyDetectLink(phy_handle_t *handle, bool link)
+{
+    phy_dp83825_resource_t *resource    = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_energy_detect_t *energy = &resource->energy;
+    uint16_t regValue;
+    status_t result;
+
+    if (link)
+    {
+        if (energy->waking)
+        {
+            energy->waking                   = false;
+            energy->stats.lastInsertToLinkUs = PHY_DP83825_GetTimeUs(handle) - energy->wakeUs;
+            if (energy->stats.lastInsertToLinkUs > energy->stats.maxInsertToLinkUs)
+            {
+                energy->stats.maxInsertToLinkUs = energy->stats.lastInsertToLinkUs;
+            }
+        }
+        return kStatus_Success;
+    }
+
+    /* Link down: stop polling once the PHY has powered down its front end. */
+    result = PHY_DP83825_READ(handle, MII_DP83822_EDCR, &regValue);
+    if ((result == kStatus_Success) && ((regValue & DP83822_EDCR_ED_PWR_STATE) == 0U))
+    {
+        energy->poweredDown = true;
+        energy->waking      = false;
+        energy->pollCount   = 0U;
+        energy->downStartUs = PHY_DP83825_GetTimeUs(handle);
+        energy->stats.powerDowns++;
+        resource->misr1Latched &= (uint16_t)~DP83822_ENERGY_DET_INT;
+    }
+    return result;
+}
+
+status_t PHY_DP83825_GetAutoNegotiationStatus(phy_handle_t *handle, bool *status)
+{
+    assert(status);
+
+    status_t result;
+    uint16_t regValue;
+
+    PHY_DP83825_BeginCall(handle);
+
+    *status = false;
+
+    /* Check auto negotiation complete. */
+    result = PHY_DP83825_READ(handle, PHY_BASICSTATUS_REG, &regValue);
+    PHY_DP83825_WatchdogObserve(handle, result, regValue);
+    if (result == kStatus_Success)
+    {
+        if ((regValue & PHY_BSTATUS_AUTONEGCOMP_MASK) != 0U)
+        {
+            *status = true;
+        }
+    }
+    return result;
+}
+
+status_t PHY_DP83825_GetLinkStatus(phy_handle_t *handle, bool *status)
+{
+    assert(status);
+
+    phy_dp83825_energy_detect_t *energy = &((phy_dp83825_resource_t *)handle->resource)->energy;
+    status_t result;
+    uint16_t regValue;
+
+    PHY_DP83825_BeginCall(handle);
+
+    if (energy->poweredDown)
+    {
+        /* Nothing on the wire, keep the bus quiet until energy shows up. */
+        result = PHY_DP83825_EnergyDetectPoll(handle);
+        if ((result != kStatus_Success) || energy->poweredDown)
+        {
+            *status = false;
+            return result;
+        }
+    }
+
+    /* Read the basic status register. */
+    result = PHY_DP83825_READ(handle, PHY_BASICSTATUS_REG, &regValue);
+    PHY_DP83825_WatchdogObserve(handle, result, regValue);
+    if (result == kStatus_Success)
+    {
+        if ((PHY_BSTATUS_LINKSTATUS_MASK & regValue) != 0U)
+        {
+            /* Link up. */
+            *status = true;
+        }
+        else
+        {
+            /* Link down. */
+            *status = false;
+        }
+        if (energy->enabled)
+        {
+            result = PHY_DP83825_EnergyDetectLink(handle, *status);
+        }
+    }
+    return result;
+}
+
+status_t PHY_DP83825_GetLinkSpeedDuplex(phy_handle_t *handle, phy_speed_t *speed, phy_duplex_t *duplex)
+{
+    assert(!((speed == NULL) && (duplex == NULL)));
+
+    status_t result;
+    uint16_t regValue;
+
+    PHY_DP83825_BeginCall(handle);
+
+    /* Read the control register. */
+    result = PHY_DP83825_READ(handle, MII_DP83822_PHYSTS, &regValue);
+    if (result == kStatus_Success)
+    {
+        if (speed != NULL)
+        {
+            if (regValue & DP83822_PHYSTS_10)
+            {
+                *speed = kPHY_Speed10M;
+            }
+            else
+            {
+                *speed = kPHY_Speed100M;
+            }
+        }
+
+        if (duplex != NULL)
+        {
+            if (regValue & DP83822_PHYSTS_DUPLEX)
+            {
+                *duplex = kPHY_FullDuplex;
+            }
+            else
+            {
+                *duplex = kPHY_HalfDuplex;
+            }
+        }
+    }
+    return result;
+}
+
+status_t PHY_DP83825_GetLinkPause(phy_handle_t *handle, bool *rxPause, bool *txPause)
+{
+    assert(rxPause);
+    assert(txPause);
+
+    uint16_t bmcr;
+    uint16_t local;
+    uint16_t partner;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    *rxPause = false;
+    *txPause = false;
+    if (((phy_dp83825_resource_t *)handle->resource)->fiber)
+    {
+        /* Nothing is negotiated on fiber, the link partner is configured to match. */
+        result = PHY_DP83825_READ(handle, PHY_AUTONEG_ADVERTISE_REG, &local);
+        if ((result == kStatus_Success) && ((local & DP83822_AN_PAUSE) != 0U))
+        {
+            *rxPause = true;
+            *txPause = true;
+        }
+        return result;
+    }
+    result = PHY_DP83825_READ(handle, PHY_BASICCONTROL_REG, &bmcr);
+    if ((result != kStatus_Success) || ((bmcr & PHY_BCTL_AUTONEG_MASK) == 0U))
+    {
+        return result;
+    }
+    result = PHY_DP83825_READ(handle, PHY_AUTONEG_ADVERTISE_REG, &local);
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_READ(handle, PHY_AUTONEG_LINKPARTNER_REG, &partner);
+    }
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+
+    if (((local & DP83822_AN_PAUSE) != 0U) && ((partner & DP83822_AN_PAUSE) != 0U))
+    {
+        *rxPause = true;
+        *txPause = true;
+    }
+    else if (((local & DP83822_AN_ASYM_PAUSE) != 0U) && ((partner & DP83822_AN_ASYM_PAUSE) != 0U))
+    {
+        /* Asymmetric pause, only the side that advertised pause acts on pause frames. */
+        *rxPause = ((local & DP83822_AN_PAUSE) != 0U);
+        *txPause = ((partner & DP83822_AN_PAUSE) != 0U);
+    }
+    else
+    {
+        /* No pause in either direction. */
+    }
+    return result;
+}
+
+status_t PHY_DP83825_SetLinkSpeedDuplex(phy_handle_t *handle, phy_speed_t speed, phy_duplex_t duplex)
+{
+    /* This PHY only supports 10/100M speed. */
+    assert(speed <= kPHY_Speed100M);
+
+    /* Disable the auto-negotiation and set according to user-defined configuration. */
+    phy_dp83825_script_t script[] = {
+        PHY_DP83825_SCRIPT_MODIFY(PHY_BASICCONTROL_REG,
+                                  PHY_BCTL_AUTONEG_MASK | PHY_BCTL_SPEED0_MASK | PHY_BCTL_DUPLEX_MASK,
+                                  ((speed == kPHY_Speed100M) ? PHY_BCTL_SPEED0_MASK : 0U) |
+                                      ((duplex == kPHY_FullDuplex) ? PHY_BCTL_DUPLEX_MASK : 0U)),
+    };
+
+    PHY_DP83825_BeginCall(handle);
+
+    if (((phy_dp83825_resource_t *)handle->resource)->fiber &&
+        ((speed != kPHY_Speed100M) || (duplex != kPHY_FullDuplex)))
+    {
+        return kStatus_InvalidArgument;
+    }
+    return PHY_DP83825_RunScript(handle, script, PHY_SCRIPT_COUNT(script));
+}
+
+#if PHY_DP83825_ENABLE_LOOPBACK
+status_t PHY_DP83825_EnableLoopback(phy_handle_t *handle, phy_loop_t mode, phy_speed_t speed, bool enable)
+{
+    /* This PHY only supports local/remote loopback and 10/100M speed. */
+    assert(mode <= kPHY_RemoteLoop);
+    assert(speed <= kPHY_Speed100M);
+    /* Remote loopback only supports 100M full-duplex. */
+    assert(!enable || (mode == kPHY_LocalLoop) || (speed == kPHY_Speed100M));
+
+    if (!enable)
+    {
+        return PHY_DP83825_SetLoopback(handle, kPHY_DP83825_LoopbackNone, speed);
+    }
+    return PHY_DP83825_SetLoopback(
+        handle, (mode == kPHY_LocalLoop) ? kPHY_DP83825_LoopbackLocal : kPHY_DP83825_LoopbackReverse, speed);
+}
+
+status_t PHY_DP83825_SetLoopback(phy_handle_t *handle, phy_dp83825_loopback_t loopback, phy_speed_t speed)
+{
+    assert(loopback < kPHY_DP83825_LoopbackCount);
+    assert(speed <= kPHY_Speed100M);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_config_t config;
+    status_t result = kStatus_Success;
+
+    PHY_DP83825_BeginCall(handle);
+
+    resource->callDepth++;
+    if (!resource->loopbackActive)
+    {
+        /* Remember what to go back to. */
+        result = PHY_DP83825_GetConfig(handle, &resource->loopbackSaved);
+    }
+    if (result == kStatus_Success)
+    {
+        config = resource->loopbackSaved;
+        if (loopback != kPHY_DP83825_LoopbackNone)
+        {
+            config.loopback = loopback;
+            config.speed    = speed;
+            config.duplex   = kPHY_FullDuplex;
+        }
+        else
+        {
+            /* A loopback configured before the saved state is left as well. */
+            config.loopback = kPHY_DP83825_LoopbackNone;
+        }
+        result = PHY_DP83825_ApplyConfig(handle, &config);
+    }
+    if (result == kStatus_Success)
+    {
+        resource->loopbackActive = (loopback != kPHY_DP83825_LoopbackNone);
+    }
+    resource->callDepth--;
+    return result;
+}
+#else
+status_t PHY_DP83825_EnableLoopback(phy_handle_t *handle, phy_loop_t mode, phy_speed_t speed, bool enable)
+{
+    /* Loopback is not part of this build, there is nothing to leave either. */
+    return enable ? kStatus_InvalidArgument : kStatus_Success;
+}
+#endif
+
+#if PHY_DP83825_ENABLE_DIAGNOSTICS
+static void PHY_DP83825_BistUpdate(phy_handle_t *handle)
+{
+    phy_dp83825_bist_t *bist = &((phy_dp83825_resource_t *)handle->resource)->bist;
+    uint32_t bitsPerUs       = (bist->config.speed == kPHY_Speed100M) ? 100U : 10U;
+    uint32_t packetBits =
+        ((uint32_t)bist->config.packetLength + PHY_DP83825_BIST_PREAMBLE_BYTES + bist->config.ipg) * 8U;
+    uint64_t dataBits;
+
+    /* The generator has no packet counter, it sends back to back at line rate. */
+    bist->stats.elapsedUs = PHY_DP83825_GetTimeUs(handle) - bist->startUs;
+    bist->stats.packets   = (uint32_t)(((uint64_t)bist->stats.elapsedUs * bitsPerUs) / packetBits);
+    dataBits              = (uint64_t)bist->stats.packets * bist->config.packetLength * 8U;
+
+    bist->stats.errorsPerGbit =
+        (dataBits != 0U) ? (uint32_t)(((uint64_t)bist->stats.errors * 1000000000U) / dataBits) : 0U;
+    bist->stats.throughputKbps =
+        (bist->stats.elapsedUs != 0U) ? (uint32_t)((dataBits * 1000U) / bist->stats.elapsedUs) : 0U;
+}
+
+status_t PHY_DP83825_StartBist(phy_handle_t *handle, const phy_dp83825_bist_config_t *config)
+{
+    assert(config);
+    assert(config->loopback < kPHY_DP83825_LoopbackCount);
+    assert(config->speed <= kPHY_Speed100M);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    uint16_t regValue;
+    status_t result;
+
+    /* Reverse loopback hands the line back to the partner, the local checker sees nothing. */
+    if ((config->loopback == kPHY_DP83825_LoopbackReverse) || (config->packetLength == 0U) ||
+        (config->packetLength > FIELD_GET(DP83822_BICSR2_PKT_LENGTH_MASK, 0xFFFFU)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    phy_dp83825_script_t script[] = {
+        PHY_DP83825_SCRIPT_WRITE(MII_DP83822_BICSR1, FIELD_PREP(DP83822_BICSR1_IPG_MASK, config->ipg)),
+        PHY_DP83825_SCRIPT_WRITE(MII_DP83822_BICSR2, FIELD_PREP(DP83822_BICSR2_PKT_LENGTH_MASK, config->packetLength)),
+        PHY_DP83825_SCRIPT_MODIFY(MII_DP83822_BISCR,
+                                  DP83822_BISCR_ERR_CNT_MODE | DP83822_BISCR_PKT_GEN_64BIT | DP83822_BISCR_PKT_GEN_EN,
+                                  DP83822_BISCR_PKT_GEN_EN),
+    };
+
+    PHY_DP83825_BeginCall(handle);
+
+    resource->callDepth++;
+    result = PHY_DP83825_SetLoopback(handle, config->loopback, config->speed);
+    resource->callDepth--;
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_RunScript(handle, script, PHY_SCRIPT_COUNT(script));
+    }
+    if (result == kStatus_Success)
+    {
+        /* The error counter and the sync loss flag clear on read, start from zero. */
+        result = PHY_DP83825_READ(handle, MII_DP83822_BICSR1, &regValue);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_READ(handle, MII_DP83822_BISCR, &regValue);
+    }
+    if (result == kStatus_Success)
+    {
+        (void)memset(&resource->bist.stats, 0, sizeof(resource->bist.stats));
+        resource->bist.config  = *config;
+        resource->bist.startUs = PHY_DP83825_GetTimeUs(handle);
+        resource->bist.running = true;
+    }
+    return result;
+}
+
+status_t PHY_DP83825_GetBistStats(phy_handle_t *handle, phy_dp83825_bist_stats_t *stats)
+{
+    assert(stats);
+
+    phy_dp83825_bist_t *bist = &((phy_dp83825_resource_t *)handle->resource)->bist;
+    status_t result          = kStatus_Success;
+    uint16_t regValue;
+    uint32_t errors;
+
+    PHY_DP83825_BeginCall(handle);
+
+    if (bist->running)
+    {
+        result = PHY_DP83825_READ(handle, MII_DP83822_BICSR1, &regValue);
+        if (result == kStatus_Success)
+        {
+            errors = FIELD_GET(DP83822_BICSR1_ERR_COUNT_MASK, regValue);
+            bist->stats.errors += errors;
+            /* The counter stops at its maximum, errors past it are lost. */
+            if (errors == FIELD_GET(DP83822_BICSR1_ERR_COUNT_MASK, 0xFFFFU))
+            {
+                bist->stats.saturated = true;
+            }
+            result = PHY_DP83825_READ(handle, MII_DP83822_BISCR, &regValue);
+        }
+        if (result == kStatus_Success)
+        {
+            bist->stats.locked |= ((regValue & DP83822_BISCR_PRBS_LOCK) != 0U);
+            bist->stats.syncLost |= ((regValue & DP83822_BISCR_PRBS_SYNC_LOSS) != 0U);
+            PHY_DP83825_BistUpdate(handle);
+        }
+    }
+    *stats = bist->stats;
+    return result;
+}
+
+status_t PHY_DP83825_StopBist(phy_handle_t *handle, phy_dp83825_bist_stats_t *stats)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_bist_stats_t last;
+    status_t result;
+    phy_dp83825_script_t script[] = {
+        PHY_DP83825_SCRIPT_CLEAR(MII_DP83822_BISCR, DP83822_BISCR_PKT_GEN_EN),
+    };
+
+    PHY_DP83825_BeginCall(handle);
+
+    resource->callDepth++;
+    result = PHY_DP83825_GetBistStats(handle, (stats != NULL) ? stats : &last);
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_RunScript(handle, script, PHY_SCRIPT_COUNT(script));
+    }
+    if (result == kStatus_Success)
+    {
+        resource->bist.running = false;
+        result                 = PHY_DP83825_SetLoopback(handle, kPHY_DP83825_LoopbackNone, kPHY_Speed100M);
+    }
+    resource->callDepth--;
+    return result;
+}
+
+status_t PHY_DP83825_RunBist(phy_handle_t *handle,
+                             const phy_dp83825_bist_config_t *config,
+                             uint32_t packets,
+                             phy_dp83825_bist_stats_t *stats)
+{
+    assert(config);
+    assert(stats);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    uint32_t bitsPerUs               = (config->speed == kPHY_Speed100M) ? 100U : 10U;
+    uint64_t remainingUs;
+    uint32_t delayUs;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    remainingUs = ((uint64_t)packets *
+                   (((uint32_t)config->packetLength + PHY_DP83825_BIST_PREAMBLE_BYTES + config->ipg) * 8U) +
+                   bitsPerUs - 1U) /
+                  bitsPerUs;
+
+    resource->callDepth++;
+    result = PHY_DP83825_StartBist(handle, config);
+    while ((result == kStatus_Success) && (remainingUs != 0U))
+    {
+        /* Empty the 8 bit error counter before it saturates. */
+        delayUs = (remainingUs < PHY_DP83825_BIST_POLL_US) ? (uint32_t)remainingUs : PHY_DP83825_BIST_POLL_US;
+        PHY_DP83825_Delay(handle, delayUs);
+        remainingUs -= delayUs;
+        result = PHY_DP83825_GetBistStats(handle, stats);
+    }
+    if (resource->bist.running)
+    {
+        /* Stop the generator even when a poll failed. */
+        status_t stopResult = PHY_DP83825_StopBist(handle, stats);
+        if (result == kStatus_Success)
+        {
+            result = stopResult;
+        }
+    }
+    resource->callDepth--;
+    return result;
+}
+
+void PHY_DP83825_DecodeCableDiag(const uint16_t *raw, phy_dp83825_cable_diag_t *result)
+{
+    assert(raw);
+    assert(result);
+
+    phy_dp83825_cable_pair_t *pair;
+    uint32_t peak;
+    uint32_t location;
+    uint32_t amplitude;
+    uint32_t distanceCm;
+    uint32_t shift;
+
+    (void)memset(result->pair, 0, sizeof(result->pair));
+    result->lengthCm = 0U;
+    for (peak = 0U; peak < (2U * DP83822_TDR_PEAKS); peak++)
+    {
+        pair      = &result->pair[peak / DP83822_TDR_PEAKS];
+        shift     = (peak & 1U) * 8U;
+        location  = FIELD_GET(DP83822_CDLRR_LOCATION_MASK, raw[peak / 2U] >> shift);
+        amplitude = FIELD_GET(DP83822_CDLAR_AMPLITUDE_MASK,
+                              raw[(MII_DP83822_CDLAR1 - MII_DP83822_CDLRR1) + (peak / 2U)] >> shift);
+        if ((location == 0U) || (amplitude < PHY_DP83825_CABLE_NOISE_AMPLITUDE))
+        {
+            continue;
+        }
+
+        /* The nearest strong reflection is the fault, nothing beyond it is cable. */
+        distanceCm = location * PHY_DP83825_CABLE_CM_PER_SAMPLE;
+        if (pair->fault != kPHY_DP83825_CableNoFault)
+        {
+            continue;
+        }
+        if (amplitude >= PHY_DP83825_CABLE_FAULT_AMPLITUDE)
+        {
+            pair->fault   = ((raw[PHY_DP83825_CABLE_RESULT_REGS - 1U] & (1U << peak)) != 0U) ?
+                                kPHY_DP83825_CableOpen :
+                                kPHY_DP83825_CableShort;
+            pair->faultCm = distanceCm;
+        }
+        if (distanceCm > pair->lengthCm)
+        {
+            pair->lengthCm = distanceCm;
+        }
+        if (pair->lengthCm > result->lengthCm)
+        {
+            result->lengthCm = pair->lengthCm;
+        }
+    }
+}
+
+status_t PHY_DP83825_StartCableDiag(phy_handle_t *handle)
+{
+    phy_dp83825_cable_job_t *job = &((phy_dp83825_resource_t *)handle->resource)->cable;
+    status_t result;
+
+    if (job->state != (uint8_t)kPHY_DP83825_CableIdle)
+    {
+        return kStatus_Busy;
+    }
+
+    PHY_DP83825_BeginCall(handle);
+
+    job->startUs      = PHY_DP83825_GetTimeUs(handle);
+    job->result.steps = 1U;
+    result            = PHY_DP83825_WRITE(handle, MII_DP83822_CDCR, DP83822_CDCR_START);
+    if (result == kStatus_Success)
+    {
+        job->state = (uint8_t)kPHY_DP83825_CableWaitDone;
+    }
+    return result;
+}
+
+status_t PHY_DP83825_StepCableDiag(phy_handle_t *handle, phy_dp83825_cable_diag_t *result)
+{
+    assert(result);
+
+    phy_dp83825_cable_job_t *job = &((phy_dp83825_resource_t *)handle->resource)->cable;
+    status_t status;
+    uint16_t regValue;
+
+    if (job->state == (uint8_t)kPHY_DP83825_CableIdle)
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+    PHY_DP83825_BeginCall(handle);
+
+    job->result.steps++;
+    if (job->state == (uint8_t)kPHY_DP83825_CableWaitDone)
+    {
+        status = PHY_DP83825_READ(handle, MII_DP83822_CDCR, &regValue);
+        if (status == kStatus_Success)
+        {
+            if ((regValue & DP83822_CDCR_FAIL) != 0U)
+            {
+                status = kStatus_Fail;
+            }
+            else if ((regValue & DP83822_CDCR_DONE) != 0U)
+            {
+                job->state = (uint8_t)kPHY_DP83825_CableReadResults;
+                job->index = 0U;
+                status     = kStatus_Busy;
+            }
+            else if ((PHY_DP83825_GetTimeUs(handle) - job->startUs) >= PHY_DP83825_CABLE_TIMEOUT_US)
+            {
+                status = kStatus_Timeout;
+            }
+            else
+            {
+                status = kStatus_Busy;
+            }
+        }
+    }
+    else
+    {
+        /* The location and amplitude registers follow each other. */
+        status = PHY_DP83825_EXTREAD(handle, DP83822_DEVADDR, MII_DP83822_CDLRR1 + job->index, &regValue);
+        if (status == kStatus_Success)
+        {
+            job->raw[job->index++] = regValue;
+            status                 = kStatus_Busy;
+            if (job->index == PHY_DP83825_CABLE_RESULT_REGS)
+            {
+                PHY_DP83825_DecodeCableDiag(job->raw, &job->result);
+                job->result.runTimeUs = PHY_DP83825_GetTimeUs(handle) - job->startUs;
+                *result               = job->result;
+                status                = kStatus_Success;
+            }
+        }
+    }
+
+    /* Anything but progress ends the job, it never holds up the next one. */
+    if (status != kStatus_Busy)
+    {
+        job->state = (uint8_t)kPHY_DP83825_CableIdle;
+    }
+    return status;
+}
+
+status_t PHY_DP83825_GetCableLength(phy_handle_t *handle, uint32_t *lengthCm)
+{
+    assert(lengthCm);
+
+    phy_dp83825_cable_job_t *job = &((phy_dp83825_resource_t *)handle->resource)->cable;
+
+    *lengthCm = job->result.lengthCm;
+    return (*lengthCm != 0U) ? kStatus_Success : kStatus_NoData;
+}
+
+status_t PHY_DP83825_ConfigureDuplexMonitor(phy_handle_t *handle, const phy_dp83825_duplex_config_t *config)
+{
+    assert(config);
+
+    phy_dp83825_duplex_monitor_t *monitor = &((phy_dp83825_resource_t *)handle->resource)->duplex;
+
+    (void)memset(monitor, 0, sizeof(*monitor));
+    monitor->config = *config;
+    return kStatus_Success;
+}
+
+status_t PHY_DP83825_CheckDuplexMismatch(phy_handle_t *handle, uint32_t macCollisions, bool *mismatch)
+{
+    assert(mismatch);
+
+    phy_dp83825_resource_t *resource      = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_duplex_monitor_t *monitor = &resource->duplex;
+    phy_dp83825_config_t config;
+    uint16_t bmcr;
+    uint16_t physts;
+    uint16_t aner;
+    uint16_t anlpar;
+    uint16_t technology;
+    uint16_t counter;
+    bool evidence;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    /* Reading the error counters adds them to the driver totals. */
+    result = PHY_DP83825_READ(handle, PHY_BASICCONTROL_REG, &bmcr);
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_READ(handle, MII_DP83822_PHYSTS, &physts);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_READ(handle, PHY_AUTONEG_EXPANSION_REG, &aner);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_READ(handle, PHY_AUTONEG_LINKPARTNER_REG, &anlpar);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_READ(handle, MII_DP83822_FCSCR, &counter);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_READ(handle, MII_DP83822_RECR, &counter);
+    }
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+
+    monitor->collisions        = (monitor->checks != 0U) ? (macCollisions - monitor->lastCollisions) : 0U;
+    monitor->falseCarriers     = (monitor->checks != 0U) ? (resource->falseCarriers - monitor->lastFalseCarriers) : 0U;
+    monitor->rxErrors          = (monitor->checks != 0U) ? (resource->rxErrors - monitor->lastRxErrors) : 0U;
+    monitor->lastCollisions    = macCollisions;
+    monitor->lastFalseCarriers = resource->falseCarriers;
+    monitor->lastRxErrors      = resource->rxErrors;
+    monitor->checks++;
+
+    /* Only an auto-negotiating PHY falls back to half duplex, a new link is checked from scratch. */
+    if (((physts & DP83822_PHYSTS_LINK) == 0U) || ((physts & DP83822_PHYSTS_DUPLEX) != 0U) ||
+        ((bmcr & PHY_BCTL_AUTONEG_MASK) == 0U))
+    {
+        monitor->parallelDetect = false;
+        monitor->mismatch       = false;
+        *mismatch               = false;
+        return kStatus_Success;
+    }
+
+    /*
+     * A partner without auto-negotiation was parallel detected, which only yields half duplex. The PHY
+     * then reports the detected technology alone in ANLPAR, it has to be the half duplex one of the link.
+     */
+    technology = ((physts & DP83822_PHYSTS_10) != 0U) ? PHY_10BASETX_HALFDUPLEX_MASK : PHY_100BASETX_HALFDUPLEX_MASK;
+    monitor->parallelDetect =
+        (((aner & DP83822_ANER_LP_AN_ABLE) == 0U) || ((aner & DP83822_ANER_PDF) != 0U)) &&
+        ((anlpar & (PHY_100BASETX_FULLDUPLEX_MASK | PHY_100BASETX_HALFDUPLEX_MASK | PHY_10BASETX_FULLDUPLEX_MASK |
+                    PHY_10BASETX_HALFDUPLEX_MASK)) == technology);
+
+    /* Half duplex against a half duplex partner is legal, only the symptoms of a mismatch count. */
+    evidence = false;
+    if ((monitor->config.collisionThreshold != 0U) && (monitor->collisions >= monitor->config.collisionThreshold))
+    {
+        evidence = true;
+    }
+    if ((monitor->config.errorThreshold != 0U) &&
+        ((monitor->falseCarriers + monitor->rxErrors) >= monitor->config.errorThreshold))
+    {
+        evidence = true;
+    }
+
+    if (monitor->parallelDetect && evidence && !monitor->mismatch)
+    {
+        monitor->mismatch = true;
+        monitor->events++;
+        PHY_DP83825_RaiseEvent(handle, kPHY_DP83825_EventDuplexMismatch);
+
+        if (monitor->config.policy == kPHY_DP83825_DuplexPolicyForceFull)
+        {
+            resource->callDepth++;
+            result = PHY_DP83825_GetConfig(handle, &config);
+            if (result == kStatus_Success)
+            {
+                config.autoNeg = false;
+                config.speed   = ((physts & DP83822_PHYSTS_10) != 0U) ? kPHY_Speed10M : kPHY_Speed100M;
+                config.duplex  = kPHY_FullDuplex;
+                result         = PHY_DP83825_ApplyConfig(handle, &config);
+            }
+            resource->callDepth--;
+        }
+    }
+    *mismatch = monitor->mismatch;
+    return result;
+}
+
+status_t PHY_DP83825_GetDuplexMonitor(phy_handle_t *handle, phy_dp83825_duplex_monitor_t *monitor)
+{
+    assert(monitor);
+
+    *monitor = ((phy_dp83825_resource_t *)handle->resource)->duplex;
+    return kStatus_Success;
+}
+#endif
+
+#if (PHY_DP83825_ENABLE_DP83826 && PHY_DP83825_ENABLE_EXT)
+static bool PHY_DP83825_VodCode(uint16_t levelBp, uint16_t defaultCode, uint16_t *code)
+{
+    int32_t value = (int32_t)defaultCode +
+                    (((int32_t)levelBp - DP83826_CFG_DAC_PERCENT_DEFAULT) / DP83826_CFG_DAC_PERCENT_PER_STEP);
+
+    *code = (uint16_t)value;
+    return (levelBp >= PHY_DP83825_VOD_MIN_BP) && ((levelBp % DP83826_CFG_DAC_PERCENT_PER_STEP) == 0U) &&
+           (value >= 0) && (value <= (int32_t)FIELD_GET(DP83826_VOD_CFG2_PLUS_MDI_MASK, 0xFFFFU));
+}
+
+static uint16_t PHY_DP83825_VodLevel(uint16_t code, uint16_t defaultCode)
+{
+    return (uint16_t)(DP83826_CFG_DAC_PERCENT_DEFAULT +
+                      (((int32_t)code - (int32_t)defaultCode) * DP83826_CFG_DAC_PERCENT_PER_STEP));
+}
+
+static status_t PHY_DP83825_VodWrite(phy_handle_t *handle, const phy_dp83825_vod_t *vod)
+{
+    uint16_t minusMdi;
+    uint16_t minusMdix;
+    uint16_t plusMdi;
+    uint16_t plusMdix;
+
+    if (!PHY_DP83825_VodCode(vod->minusMdiBp, DP83826_CFG_DAC_MINUS_DEFAULT, &minusMdi) ||
+        !PHY_DP83825_VodCode(vod->minusMdixBp, DP83826_CFG_DAC_MINUS_DEFAULT, &minusMdix) ||
+        !PHY_DP83825_VodCode(vod->plusMdiBp, DP83826_CFG_DAC_PLUS_DEFAULT, &plusMdi) ||
+        !PHY_DP83825_VodCode(vod->plusMdixBp, DP83826_CFG_DAC_PLUS_DEFAULT, &plusMdix))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* The MDI-X minus level is split over both registers. */
+    phy_dp83825_script_t script[] = {
+        PHY_DP83825_SCRIPT_EXT_MODIFY(
+            MII_DP83826_VOD_CFG1, DP83826_VOD_CFG1_MINUS_MDIX_MASK | DP83826_VOD_CFG1_MINUS_MDI_MASK,
+            FIELD_PREP(DP83826_VOD_CFG1_MINUS_MDIX_MASK, FIELD_GET(DP83826_CFG_DAC_MINUS_MDIX_5_TO_4, minusMdix)) |
+                FIELD_PREP(DP83826_VOD_CFG1_MINUS_MDI_MASK, minusMdi)),
+        PHY_DP83825_SCRIPT_EXT_MODIFY(
+            MII_DP83826_VOD_CFG2,
+            DP83826_VOD_CFG2_MINUS_MDIX_MASK | DP83826_VOD_CFG2_PLUS_MDIX_MASK | DP83826_VOD_CFG2_PLUS_MDI_MASK,
+            FIELD_PREP(DP83826_VOD_CFG2_MINUS_MDIX_MASK, FIELD_GET(DP83826_CFG_DAC_MINUS_MDIX_3_TO_0, minusMdix)) |
+                FIELD_PREP(DP83826_VOD_CFG2_PLUS_MDIX_MASK, plusMdix) |
+                FIELD_PREP(DP83826_VOD_CFG2_PLUS_MDI_MASK, plusMdi)),
+    };
+
+    return PHY_DP83825_RunScript(handle, script, PHY_SCRIPT_COUNT(script));
+}
+
+static status_t PHY_DP83825_VodApplyLevel(phy_handle_t *handle, uint16_t levelBp)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_vod_t vod            = {levelBp, levelBp, levelBp, levelBp};
+    status_t result;
+
+    result = PHY_DP83825_VodWrite(handle, &vod);
+    if (result == kStatus_Success)
+    {
+        resource->vod.setting = vod;
+        resource->vod.valid   = true;
+        resource->vod.levelBp = levelBp;
+    }
+    return result;
+}
+
+status_t PHY_DP83825_SetVod(phy_handle_t *handle, const phy_dp83825_vod_t *vod)
+{
+    assert(vod);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    status_t result;
+
+    if (!PHY_DP83825_HasCap(handle, PHY_DP83825_CAP_VOD))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    PHY_DP83825_BeginCall(handle);
+
+    result = PHY_DP83825_VodWrite(handle, vod);
+    if (result == kStatus_Success)
+    {
+        resource->vod.setting = *vod;
+        resource->vod.valid   = true;
+    }
+    return result;
+}
+
+status_t PHY_DP83825_GetVod(phy_handle_t *handle, phy_dp83825_vod_t *vod)
+{
+    assert(vod);
+
+    uint16_t cfg1;
+    uint16_t cfg2;
+    uint16_t minusMdix;
+    status_t result;
+
+    if (!PHY_DP83825_HasCap(handle, PHY_DP83825_CAP_VOD))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    PHY_DP83825_BeginCall(handle);
+
+    result = PHY_DP83825_EXTREAD(handle, DP83822_DEVADDR, MII_DP83826_VOD_CFG1, &cfg1);
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_EXTREAD(handle, DP83822_DEVADDR, MII_DP83826_VOD_CFG2, &cfg2);
+    }
+    if (result == kStatus_Success)
+    {
+        minusMdix = (uint16_t)(FIELD_PREP(DP83826_CFG_DAC_MINUS_MDIX_5_TO_4,
+                                          FIELD_GET(DP83826_VOD_CFG1_MINUS_MDIX_MASK, cfg1)) |
+                               FIELD_PREP(DP83826_CFG_DAC_MINUS_MDIX_3_TO_0,
+                                          FIELD_GET(DP83826_VOD_CFG2_MINUS_MDIX_MASK, cfg2)));
+        vod->minusMdiBp =
+            PHY_DP83825_VodLevel(FIELD_GET(DP83826_VOD_CFG1_MINUS_MDI_MASK, cfg1), DP83826_CFG_DAC_MINUS_DEFAULT);
+        vod->minusMdixBp = PHY_DP83825_VodLevel(minusMdix, DP83826_CFG_DAC_MINUS_DEFAULT);
+        vod->plusMdiBp =
+            PHY_DP83825_VodLevel(FIELD_GET(DP83826_VOD_CFG2_PLUS_MDI_MASK, cfg2), DP83826_CFG_DAC_PLUS_DEFAULT);
+        vod->plusMdixBp =
+            PHY_DP83825_VodLevel(FIELD_GET(DP83826_VOD_CFG2_PLUS_MDIX_MASK, cfg2), DP83826_CFG_DAC_PLUS_DEFAULT);
+    }
+    return result;
+}
+
+status_t PHY_DP83825_EnableAutoVod(phy_handle_t *handle, const phy_dp83825_vod_auto_config_t *config)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_vod_state_t *vod     = &resource->vod;
+    uint16_t code;
+#if PHY_DP83825_ENABLE_DIAGNOSTICS
+    uint32_t lengthCm;
+#endif
+
+    if (!PHY_DP83825_HasCap(handle, PHY_DP83825_CAP_VOD))
+    {
+        return kStatus_InvalidArgument;
+    }
+    if (config == NULL)
+    {
+        vod->autoEnabled = false;
+        return kStatus_Success;
+    }
+    if (!PHY_DP83825_VodCode(config->minBp, DP83826_CFG_DAC_MINUS_DEFAULT, &code) ||
+        !PHY_DP83825_VodCode(config->shortCableBp, DP83826_CFG_DAC_MINUS_DEFAULT, &code) ||
+        (config->minBp > DP83826_CFG_DAC_PERCENT_DEFAULT) || (config->shortCableBp < config->minBp))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    PHY_DP83825_BeginCall(handle);
+
+    vod->autoConfig   = *config;
+    vod->autoEnabled  = true;
+    vod->floorBp      = config->minBp;
+    vod->cleanUpdates = 0U;
+    vod->lastErrors   = resource->falseCarriers + resource->rxErrors;
+
+#if PHY_DP83825_ENABLE_DIAGNOSTICS
+    /* A short cable needs less than the nominal amplitude from the start. */
+    if ((PHY_DP83825_GetCableLength(handle, &lengthCm) == kStatus_Success) && (lengthCm <= config->shortCableCm))
+    {
+        return PHY_DP83825_VodApplyLevel(handle, config->shortCableBp);
+    }
+#endif
+    return PHY_DP83825_VodApplyLevel(handle, DP83826_CFG_DAC_PERCENT_DEFAULT);
+}
+
+status_t PHY_DP83825_UpdateAutoVod(phy_handle_t *handle, uint16_t *levelBp)
+{
+    assert(levelBp);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_vod_state_t *vod     = &resource->vod;
+    uint16_t physts;
+    uint16_t counter;
+    uint16_t level;
+    uint32_t errors;
+    status_t result;
+
+    if (!vod->autoEnabled)
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+    PHY_DP83825_BeginCall(handle);
+
+    /* Reading the error counters adds them to the driver totals. */
+    result = PHY_DP83825_READ(handle, MII_DP83822_PHYSTS, &physts);
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_READ(handle, MII_DP83822_FCSCR, &counter);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_READ(handle, MII_DP83822_RECR, &counter);
+    }
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+
+    errors          = resource->falseCarriers + resource->rxErrors - vod->lastErrors;
+    vod->lastErrors = resource->falseCarriers + resource->rxErrors;
+    level           = vod->levelBp;
+
+    /* Errors without a link say nothing about the amplitude. */
+    if ((physts & DP83822_PHYSTS_LINK) == 0U)
+    {
+        vod->cleanUpdates = 0U;
+    }
+    else if ((vod->autoConfig.errorThreshold != 0U) && (errors >= vod->autoConfig.errorThreshold))
+    {
+        /* Step up and never come back below a level that gave errors. */
+        if (level < DP83826_CFG_DAC_PERCENT_DEFAULT)
+        {
+            level += DP83826_CFG_DAC_PERCENT_PER_STEP;
+        }
+        vod->floorBp      = level;
+        vod->cleanUpdates = 0U;
+    }
+    else if (errors == 0U)
+    {
+        vod->cleanUpdates++;
+        if ((vod->cleanUpdates >= vod->autoConfig.stableUpdates) &&
+            (level >= (vod->floorBp + DP83826_CFG_DAC_PERCENT_PER_STEP)))
+        {
+            level -= DP83826_CFG_DAC_PERCENT_PER_STEP;
+            vod->cleanUpdates = 0U;
+        }
+    }
+    else
+    {
+        vod->cleanUpdates = 0U;
+    }
+
+    if (level != vod->levelBp)
+    {
+        result = PHY_DP83825_VodApplyLevel(handle, level);
+    }
+    *levelBp = vod->levelBp;
+    return result;
+}
+#endif
+
+status_t PHY_DP83825_EnableAutoMDIX(phy_handle_t *handle, phy_interrupt_type_t type, bool enable)
+{
+    phy_dp83825_script_t script[] = {
+        PHY_DP83825_SCRIPT_MODIFY(MII_DP83822_PHYCR, DP83822_MDIX_AUTO_EN, enable ? DP83822_MDIX_AUTO_EN : 0U),
+    };
+
+    PHY_DP83825_BeginCall(handle);
+
+    return PHY_DP83825_RunScript(handle, script, PHY_SCRIPT_COUNT(script));
+}
+
+#if PHY_DP83825_ENABLE_WOL
+status_t PHY_DP83825_EnableWakeOnLan(phy_handle_t *handle, phy_interrupt_type_t type, bool enable)
+{
+    status_t result;
+    uint16_t regValue;
+
+    PHY_DP83825_BeginCall(handle);
+
+    result = PHY_DP83825_EXTREAD(handle, DP83822_DEVADDR, MII_DP83822_WOL_CFG, &regValue);
+    if (result == kStatus_Success)
+    {
+        /* Enable/Disable Wake on lan. */
+        if (enable)
+        {
+            regValue |= DP83822_WOL_EN | DP83822_WOL_MAGIC_EN | DP83822_WOL_INDICATION_SEL | DP83822_WOL_CLR_INDICATION;
+        }
+        else
+        {
+            regValue &= ~(DP83822_WOL_EN | DP83822_WOL_MAGIC_EN | DP83822_WOL_SECURE_ON);
+        }
+        result = PHY_DP83825_EXTWRITE(handle, DP83822_DEVADDR, MII_DP83822_WOL_CFG, regValue);
+    }
+    return result;
+}
+
+status_t PHY_DP83825_ConfigureWakeOnLan(phy_handle_t *handle, const phy_dp83825_wol_config_t *config)
+{
+    assert(config);
+
+    const uint8_t *mac      = config->macAddr;
+    const uint8_t *password = config->password;
+    phy_dp83825_script_t script[7];
+    uint32_t count = 0U;
+    uint16_t regValue;
+    status_t result;
+
+    if (!config->magic && !config->secureOn)
+    {
+        return PHY_DP83825_EnableWakeOnLan(handle, kPHY_IntrActiveLow, false);
+    }
+
+    PHY_DP83825_BeginCall(handle);
+
+    script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_EXT_WRITE(MII_DP83822_WOL_DA1,
+                                                                         (uint16_t)((mac[1] << 8U) | mac[0]));
+    script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_EXT_WRITE(MII_DP83822_WOL_DA2,
+                                                                         (uint16_t)((mac[3] << 8U) | mac[2]));
+    script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_EXT_WRITE(MII_DP83822_WOL_DA3,
+                                                                         (uint16_t)((mac[5] << 8U) | mac[4]));
+    if (config->secureOn)
+    {
+        /* The password registers are only used with SecureOn. */
+        script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_EXT_WRITE(
+            MII_DP83822_RXSOP1, (uint16_t)((password[1] << 8U) | password[0]));
+        script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_EXT_WRITE(
+            MII_DP83822_RXSOP2, (uint16_t)((password[3] << 8U) | password[2]));
+        script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_EXT_WRITE(
+            MII_DP83822_RXSOP3, (uint16_t)((password[5] << 8U) | password[4]));
+    }
+    script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_EXT_MODIFY(
+        MII_DP83822_WOL_CFG,
+        DP83822_WOL_EN | DP83822_WOL_MAGIC_EN | DP83822_WOL_SECURE_ON | DP83822_WOL_INDICATION_SEL |
+            DP83822_WOL_CLR_INDICATION,
+        DP83822_WOL_EN | DP83822_WOL_MAGIC_EN | DP83822_WOL_INDICATION_SEL | DP83822_WOL_CLR_INDICATION |
+            (config->secureOn ? DP83822_WOL_SECURE_ON : 0U));
+
+    /* Drop a wake indication left from before. */
+    result = PHY_DP83825_READ(handle, MII_DP83822_MISR2, &regValue);
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+    ((phy_dp83825_resource_t *)handle->resource)->misr2Latched &= (uint16_t)~DP83822_WOL_PKT_INT;
+
+    return PHY_DP83825_RunScript(handle, script, count);
+}
+
+status_t PHY_DP83825_GetWakeStatus(phy_handle_t *handle, bool *woken)
+{
+    assert(woken);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    uint16_t regValue;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    result = PHY_DP83825_READ(handle, MII_DP83822_MISR2, &regValue);
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+    *woken = (resource->misr2Latched & DP83822_WOL_PKT_INT) != 0U;
+    resource->misr2Latched &= (uint16_t)~DP83822_WOL_PKT_INT;
+    if (*woken)
+    {
+        result = PHY_DP83825_RunScript(handle, s_wolClearScript, PHY_SCRIPT_COUNT(s_wolClearScript));
+    }
+    return result;
+}
+
+status_t PHY_DP83825_Suspend(phy_handle_t *handle, const phy_dp83825_wol_config_t *wol, phy_dp83825_config_t *saved)
+{
+    assert(saved);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_config_t sleep;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    resource->callDepth++;
+    result = PHY_DP83825_GetConfig(handle, saved);
+    if (result == kStatus_Success)
+    {
+        result = (wol != NULL) ? PHY_DP83825_ConfigureWakeOnLan(handle, wol) :
+                                 PHY_DP83825_EnableWakeOnLan(handle, kPHY_IntrActiveLow, true);
+    }
+    if (result == kStatus_Success)
+    {
+        /* Same configuration, plus the wake interrupt. */
+        sleep = *saved;
+        sleep.interruptMask |= (uint16_t)FIELD_PREP(PHY_DP83825_INT_MISR2_MASK, DP83822_WOL_PKT_INT_EN);
+        result = PHY_DP83825_ApplyConfig(handle, &sleep);
+    }
+    resource->callDepth--;
+    return result;
+}
+
+status_t PHY_DP83825_Resume(phy_handle_t *handle, const phy_dp83825_config_t *saved, bool *woken)
+{
+    assert(saved);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    uint16_t regValue;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    /* Latch the wake indication before the configuration read clears it. */
+    result = PHY_DP83825_READ(handle, MII_DP83822_MISR2, &regValue);
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+    if (woken != NULL)
+    {
+        *woken = (resource->misr2Latched & DP83822_WOL_PKT_INT) != 0U;
+    }
+    resource->misr2Latched &= (uint16_t)~DP83822_WOL_PKT_INT;
+
+    /* The PHY may have been powered down, do not trust the shadow. */
+    resource->shadow.valid = 0U;
+
+    resource->callDepth++;
+    result = PHY_DP83825_EnableWakeOnLan(handle, kPHY_IntrActiveLow, false);
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_ApplyConfig(handle, saved);
+    }
+    resource->callDepth--;
+    return result;
+}
+#endif
+
+#if PHY_DP83825_ENABLE_EXT
+/*!
+ * @brief Reset values of the shadowed registers, in the bits that do not depend on straps.
+ *
+ * PHY_DP83825_Restore() takes a register away from its reset value as sentinel. MISR is left out,
+ * reading it clears the pending interrupts, and BMCR is always compared.
+ */
+static const uint16_t s_shadowResetMask[PHY_DP83825_SHADOW_COUNT] = {
+    (uint16_t)~(DP83822_RX_UNF_STS | DP83822_RX_OVF_STS),
+    0U,
+    0U,
+    DP83822_PHYSCR_INT_OE | DP83822_PHYSCR_INTEN,
+    0U,
+    0xFFFFU,
+    DP83822_BISCR_PKT_GEN_EN | DP83822_BISCR_LOOPBACKMODE_MASK,
+    0U,
+};
+
+static const uint16_t s_shadowReset[PHY_DP83825_SHADOW_COUNT] = {
+    0x0061U, 0U, 0U, 0U, 0U, 0x01E1U, 0U, 0U,
+};
+
+static status_t PHY_DP83825_MmdBurst(
+    phy_handle_t *handle, uint8_t devAddr, uint16_t regAddr, uint16_t *data, uint32_t count, bool write)
+{
+    uint16_t regcr = (uint16_t)FIELD_PREP(DP83822_REGCR_DEVAD_MASK, devAddr);
+    status_t result;
+    uint32_t index;
+
+    /* Set the address once, each data access then moves on to the next register. */
+    result = PHY_DP83825_WRITE(handle, MII_DP83822_REGCR, regcr);
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_WRITE(handle, MII_DP83822_ADDAR, regAddr);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_WRITE(handle, MII_DP83822_REGCR, regcr | DP83822_REGCR_DATA_INC);
+    }
+    for (index = 0U; (index < count) && (result == kStatus_Success); index++)
+    {
+        result = write ? PHY_DP83825_WRITE(handle, MII_DP83822_ADDAR, data[index]) :
+                         PHY_DP83825_READ(handle, MII_DP83822_ADDAR, &data[index]);
+    }
+    return result;
+}
+
+status_t PHY_DP83825_Checkpoint(phy_handle_t *handle, phy_dp83825_checkpoint_t *checkpoint, bool powerDown)
+{
+    assert(checkpoint);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    uint16_t wol[PHY_DP83825_WOL_BURST_REGS];
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    (void)memset(checkpoint, 0, sizeof(*checkpoint));
+    result = PHY_DP83825_ShadowRead(handle, checkpoint->basic);
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_READ(handle, MII_DP83822_EDCR, &checkpoint->edcr);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_MmdBurst(handle, DP83822_DEVADDR, MII_DP83822_WOL_CFG, wol, PHY_DP83825_WOL_BURST_REGS,
+                                      false);
+    }
+    if (result == kStatus_Success)
+    {
+        /* WOL_STAT sits between the configuration and the addresses. */
+        checkpoint->wolCfg = wol[0];
+        (void)memcpy(checkpoint->wol, &wol[2], sizeof(checkpoint->wol));
+        result = PHY_DP83825_EXTREAD(handle, DP83822_MMD_AN, MII_DP83822_EEE_ADV, &checkpoint->eeeAdv);
+    }
+    if ((result == kStatus_Success) && PHY_DP83825_HasCap(handle, PHY_DP83825_CAP_VOD))
+    {
+        result = PHY_DP83825_MmdBurst(handle, DP83822_DEVADDR, MII_DP83826_VOD_CFG1, checkpoint->vod, 2U, false);
+    }
+    if ((result != kStatus_Success) || !powerDown)
+    {
+        return result;
+    }
+
+    result = PHY_DP83825_WRITE(handle, PHY_BASICCONTROL_REG,
+                               checkpoint->basic[kPHY_DP83825_ShadowBmcr] | DP83822_BMCR_POWER_DOWN);
+    if (result == kStatus_Success)
+    {
+        checkpoint->poweredDown = true;
+        if (resource->linkUp)
+        {
+            resource->linkUp = false;
+            PHY_DP83825_RaiseEvent(handle, kPHY_DP83825_EventLinkDown);
+        }
+    }
+    return result;
+}
+
+status_t PHY_DP83825_Restore(phy_handle_t *handle,
+                             const phy_dp83825_checkpoint_t *checkpoint,
+                             phy_dp83825_restore_t *restore)
+{
+    assert(checkpoint);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_script_t script[PHY_DP83825_SHADOW_COUNT + 1U];
+    uint32_t startUs                 = PHY_DP83825_GetTimeUs(handle);
+    uint32_t startFrames             = resource->retryStats.frames;
+    uint16_t bmcr                    = checkpoint->basic[kPHY_DP83825_ShadowBmcr];
+    uint32_t sentinel                = (uint32_t)kPHY_DP83825_ShadowBmcr;
+    uint32_t count                   = 0U;
+    bool lost                        = false;
+    uint16_t regValue;
+    uint32_t index;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    if ((bmcr & PHY_BCTL_AUTONEG_MASK) != 0U)
+    {
+        bmcr |= PHY_BCTL_RESTART_AUTONEG_MASK;
+    }
+
+    /*
+     * BMCR and a register captured away from its reset value are the sentinel: a PHY that lost
+     * power or was reset holds neither. BMCR alone may well be at its reset value.
+     */
+    for (index = 0U; index < (uint32_t)kPHY_DP83825_ShadowBmcr; index++)
+    {
+        if ((checkpoint->basic[index] & s_shadowResetMask[index]) != s_shadowReset[index])
+        {
+            sentinel = index;
+            break;
+        }
+    }
+    result = PHY_DP83825_READ(handle, PHY_BASICCONTROL_REG, &regValue);
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+    regValue &= (uint16_t)~s_shadowVolatile[kPHY_DP83825_ShadowBmcr];
+    if (regValue != (checkpoint->basic[kPHY_DP83825_ShadowBmcr] |
+                     (checkpoint->poweredDown ? DP83822_BMCR_POWER_DOWN : 0U)))
+    {
+        lost = true;
+    }
+    else if (sentinel == (uint32_t)kPHY_DP83825_ShadowBmcr)
+    {
+        /* Nothing tells the captured state from the reset one, write everything back. */
+        lost = true;
+    }
+    else
+    {
+        result = PHY_DP83825_READ(handle, s_shadowRegs[sentinel], &regValue);
+        if (result != kStatus_Success)
+        {
+            return result;
+        }
+        lost = (regValue & (uint16_t)~s_shadowVolatile[sentinel]) != checkpoint->basic[sentinel];
+    }
+
+    if (!lost)
+    {
+        if (checkpoint->poweredDown)
+        {
+            result = PHY_DP83825_WRITE(handle, PHY_BASICCONTROL_REG, bmcr);
+        }
+    }
+    else
+    {
+        resource->shadow.valid = 0U;
+
+        /* MAC interface first, the link configuration and BMCR last. */
+        script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_WAIT(PHY_BASICCONTROL_REG, PHY_BCTL_RESET_MASK, 0U,
+                                                                        PHY_RESET_TIMEOUT_MS);
+        script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_WRITE(
+            MII_DP83822_RCSR, checkpoint->basic[kPHY_DP83825_ShadowRcsr]);
+        result = PHY_DP83825_RunScript(handle, script, count);
+
+        if ((result == kStatus_Success) && ((checkpoint->wolCfg & DP83822_WOL_EN) != 0U))
+        {
+            result = PHY_DP83825_MmdBurst(handle, DP83822_DEVADDR, MII_DP83822_WOL_DA1, (uint16_t *)checkpoint->wol,
+                                          PHY_DP83825_CHECKPOINT_WOL_REGS, true);
+        }
+        if (result == kStatus_Success)
+        {
+            result = PHY_DP83825_EXTWRITE(handle, DP83822_DEVADDR, MII_DP83822_WOL_CFG, checkpoint->wolCfg);
+        }
+        if (result == kStatus_Success)
+        {
+            result = PHY_DP83825_EXTWRITE(handle, DP83822_MMD_AN, MII_DP83822_EEE_ADV, checkpoint->eeeAdv);
+        }
+        if ((result == kStatus_Success) && PHY_DP83825_HasCap(handle, PHY_DP83825_CAP_VOD))
+        {
+            result = PHY_DP83825_MmdBurst(handle, DP83822_DEVADDR, MII_DP83826_VOD_CFG1, (uint16_t *)checkpoint->vod,
+                                          2U, true);
+        }
+
+        count           = 0U;
+        script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_WRITE(MII_DP83822_EDCR, checkpoint->edcr);
+        for (index = (uint32_t)kPHY_DP83825_ShadowMisr1; index < (uint32_t)kPHY_DP83825_ShadowBmcr; index++)
+        {
+            script[count++] =
+                (phy_dp83825_script_t)PHY_DP83825_SCRIPT_WRITE(s_shadowRegs[index], checkpoint->basic[index]);
+        }
+        script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_WRITE(PHY_BASICCONTROL_REG, bmcr);
+        if (result == kStatus_Success)
+        {
+            result = PHY_DP83825_RunScript(handle, script, count);
+        }
+    }
+
+    if (restore != NULL)
+    {
+        restore->lost   = lost;
+        restore->frames = resource->retryStats.frames - startFrames;
+        restore->timeUs = PHY_DP83825_GetTimeUs(handle) - startUs;
+    }
+    return result;
+}
+#endif
+
+status_t PHY_DP83825_EnableLinkInterrupt(phy_handle_t *handle, phy_interrupt_type_t type, bool enable)
+{
+    assert((type == kPHY_IntrActiveLow) || (type == kPHY_IntrActiveHigh));
+
+    PHY_DP83825_BeginCall(handle);
+
+    /* Enable/Disable link up+down interrupt. */
+    if (enable)
+    {
+        return PHY_DP83825_RunScript(handle, s_linkIntrEnableScript, PHY_SCRIPT_COUNT(s_linkIntrEnableScript));
+    }
+    return PHY_DP83825_RunScript(handle, s_linkIntrDisableScript, PHY_SCRIPT_COUNT(s_linkIntrDisableScript));
+}
+
+status_t PHY_DP83825_ClearInterrupt(phy_handle_t *handle)
+{
+    uint16_t regValue;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    result = PHY_DP83825_READ(handle, MII_DP83822_MISR1, &regValue);
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+    result = PHY_DP83825_READ(handle, MII_DP83822_MISR2, &regValue);
+
+    return result;
+}
+
+static void PHY_DP83825_FlapDecay(phy_dp83825_flap_t *flap, uint32_t nowUs)
+{
+    uint32_t stepUs = flap->config.halfLifeUs / PHY_DP83825_FLAP_DECAY_STEPS;
+    uint32_t steps  = (nowUs - flap->decayUs) / stepUs;
+
+    if (flap->stats.penalty == 0U)
+    {
+        flap->decayUs = nowUs;
+        return;
+    }
+
+    /* Whole steps only, the decay must not depend on how often it is called. */
+    flap->decayUs += steps * stepUs;
+    flap->stats.penalty = ((steps / PHY_DP83825_FLAP_DECAY_STEPS) < 32U) ?
+                              (flap->stats.penalty >> (steps / PHY_DP83825_FLAP_DECAY_STEPS)) :
+                              0U;
+    for (steps %= PHY_DP83825_FLAP_DECAY_STEPS; steps > 0U; steps--)
+    {
+        flap->stats.penalty = (uint32_t)(((uint64_t)flap->stats.penalty * PHY_DP83825_FLAP_DECAY_FACTOR) >> 16U);
+    }
+}
+
+static void PHY_DP83825_FlapReport(phy_handle_t *handle, bool linkUp)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+
+    if (linkUp != resource->linkUp)
+    {
+        resource->linkUp = linkUp;
+        PHY_DP83825_RaiseEvent(handle, linkUp ? kPHY_DP83825_EventLinkUp : kPHY_DP83825_EventLinkDown);
+    }
+}
+
+static void PHY_DP83825_FlapInput(phy_handle_t *handle, bool linkUp)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_flap_t *flap         = &resource->flap;
+    uint32_t nowUs                   = PHY_DP83825_GetTimeUs(handle);
+
+    if (linkUp == flap->rawUp)
+    {
+        return;
+    }
+    flap->rawUp    = linkUp;
+    flap->changeUs = nowUs;
+
+    if (!linkUp)
+    {
+        PHY_DP83825_FlapDecay(flap, nowUs);
+        flap->stats.flaps++;
+        flap->stats.intervalFlaps++;
+        flap->stats.penalty = ((flap->ceiling - flap->stats.penalty) > flap->config.penalty) ?
+                                  (flap->stats.penalty + flap->config.penalty) :
+                                  flap->ceiling;
+        if (!flap->stats.suppressed && (flap->stats.penalty >= flap->config.suppressThreshold))
+        {
+            flap->stats.suppressed = true;
+            flap->suppressUs       = nowUs;
+            flap->stats.suppressions++;
+        }
+    }
+    else if (resource->linkUp)
+    {
+        /* Back up before the hold-down was over, nobody saw the link go. */
+        flap->stats.filteredDowns++;
+    }
+    (void)PHY_DP83825_ProcessFlapTimer(handle);
+}
+
+status_t PHY_DP83825_ProcessInterrupt(phy_handle_t *handle)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    bool linkUp                      = false;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    resource->callDepth++;
+    result = PHY_DP83825_ClearInterrupt(handle);
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_GetLinkStatus(handle, &linkUp);
+    }
+    resource->callDepth--;
+
+    /* The interrupt status does not tell the direction, the link state does. */
+    if ((result == kStatus_Success) && resource->flap.enabled)
+    {
+        PHY_DP83825_FlapInput(handle, linkUp);
+    }
+    else if ((result == kStatus_Success) && (linkUp != resource->linkUp))
+    {
+        resource->linkUp = linkUp;
+        PHY_DP83825_RaiseEvent(handle, linkUp ? kPHY_DP83825_EventLinkUp : kPHY_DP83825_EventLinkDown);
+    }
+    return result;
+}
+
+status_t PHY_DP83825_ConfigureFlapDamping(phy_handle_t *handle, const phy_dp83825_flap_config_t *config)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_flap_t *flap         = &resource->flap;
+    uint32_t shift;
+
+    if (config == NULL)
+    {
+        /* Hand out the link change still waiting for its hold time. */
+        flap->enabled = false;
+        PHY_DP83825_FlapReport(handle, flap->rawUp);
+        return kStatus_Success;
+    }
+    if ((resource->getTimeUs == NULL) || (config->halfLifeUs < PHY_DP83825_FLAP_DECAY_STEPS) ||
+        (config->reuseThreshold >= config->suppressThreshold))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    (void)memset(flap, 0, sizeof(*flap));
+    flap->enabled    = true;
+    flap->config     = *config;
+    flap->rawUp      = resource->linkUp;
+    flap->changeUs   = PHY_DP83825_GetTimeUs(handle);
+    flap->decayUs    = flap->changeUs;
+    flap->intervalUs = flap->changeUs;
+
+    /* A penalty above the ceiling would keep the link down longer than maxSuppressUs. */
+    shift         = config->maxSuppressUs / config->halfLifeUs;
+    flap->ceiling = UINT32_MAX;
+    if ((shift < 32U) && (config->reuseThreshold <= (UINT32_MAX >> shift)))
+    {
+        flap->ceiling = config->reuseThreshold << shift;
+    }
+    if (flap->ceiling < config->suppressThreshold)
+    {
+        flap->ceiling = config->suppressThreshold;
+    }
+    return kStatus_Success;
+}
+
+uint32_t PHY_DP83825_ProcessFlapTimer(phy_handle_t *handle)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_flap_t *flap         = &resource->flap;
+    uint32_t nextUs                  = 0U;
+    uint32_t nowUs;
+    uint32_t holdUs;
+    uint32_t elapsedUs;
+
+    if (!flap->enabled)
+    {
+        return 0U;
+    }
+
+    nowUs = PHY_DP83825_GetTimeUs(handle);
+    PHY_DP83825_FlapDecay(flap, nowUs);
+    if ((flap->config.intervalUs != 0U) && ((nowUs - flap->intervalUs) >= flap->config.intervalUs))
+    {
+        if (flap->stats.intervalFlaps > flap->stats.maxIntervalFlaps)
+        {
+            flap->stats.maxIntervalFlaps = flap->stats.intervalFlaps;
+        }
+        flap->stats.lastIntervalFlaps = flap->stats.intervalFlaps;
+        flap->stats.intervalFlaps     = 0U;
+        flap->intervalUs              = nowUs;
+    }
+
+    if (flap->stats.suppressed && ((flap->stats.penalty <= flap->config.reuseThreshold) ||
+                                   ((nowUs - flap->suppressUs) >= flap->config.maxSuppressUs)))
+    {
+        flap->stats.suppressed = false;
+    }
+
+    if (flap->stats.suppressed)
+    {
+        /* Held down right away, the hold-down is for single drops. */
+        PHY_DP83825_FlapReport(handle, false);
+        nextUs = flap->config.halfLifeUs / PHY_DP83825_FLAP_DECAY_STEPS;
+        if ((flap->config.maxSuppressUs - (nowUs - flap->suppressUs)) < nextUs)
+        {
+            nextUs = flap->config.maxSuppressUs - (nowUs - flap->suppressUs);
+        }
+    }
+    else if (flap->rawUp != resource->linkUp)
+    {
+        holdUs    = flap->rawUp ? flap->config.holdUpUs : flap->config.holdDownUs;
+        elapsedUs = nowUs - flap->changeUs;
+        if (elapsedUs >= holdUs)
+        {
+            PHY_DP83825_FlapReport(handle, flap->rawUp);
+        }
+        else
+        {
+            nextUs = holdUs - elapsedUs;
+        }
+    }
+    return nextUs;
+}
+
+void PHY_DP83825_GetFlapStats(phy_handle_t *handle, phy_dp83825_flap_stats_t *stats)
+{
+    assert(stats);
+
+    *stats = ((phy_dp83825_resource_t *)handle->resource)->flap.stats;
+}
+
+#if PHY_DP83825_ENABLE_EXT
+status_t PHY_DP83825_EnableEEE(phy_handle_t *handle, bool enable)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    bool changed                     = false;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    result = PHY_DP83825_EeeAdvertise(handle, enable, &changed);
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+    resource->config.enableEEE = enable;
+    if (!changed)
+    {
+        return result;
+    }
+
+    /* The link partner only learns about the new advertisement by renegotiating. */
+    return PHY_DP83825_RestartAutoNeg(handle);
+}
+
+status_t PHY_DP83825_GetEEEStatus(phy_handle_t *handle, phy_dp83825_eee_status_t *status)
+{
+    assert(status);
+
+    uint16_t advertise;
+    uint16_t partner;
+    uint16_t pcsStatus;
+    uint16_t physts;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    result = PHY_DP83825_EXTREAD(handle, DP83822_MMD_AN, MII_DP83822_EEE_ADV, &advertise);
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_EXTREAD(handle, DP83822_MMD_AN, MII_DP83822_EEE_LPABLE, &partner);
+    }
+    if (result == kStatus_Success)
+    {
+        /* LPI received bits are latched, cleared by this read. */
+        result = PHY_DP83825_EXTREAD(handle, DP83822_MMD_PCS, MII_DP83822_PCS_STAT1, &pcsStatus);
+    }
+    if (result == kStatus_Success)
+    {
+        /* The wake error counter clears on read. */
+        result = PHY_DP83825_EXTREAD(handle, DP83822_MMD_PCS, MII_DP83822_EEE_WAKE_ERR, &status->wakeErrors);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_READ(handle, MII_DP83822_PHYSTS, &physts);
+    }
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+
+    status->advertised    = (advertise & DP83822_EEE_100TX) != 0U;
+    status->partner       = (partner & DP83822_EEE_100TX) != 0U;
+    status->active        = status->advertised && status->partner && ((physts & DP83822_PHYSTS_LINK) != 0U) &&
+                            ((physts & DP83822_PHYSTS_10) == 0U) && ((physts & DP83822_PHYSTS_DUPLEX) != 0U);
+    status->rxLpi         = (pcsStatus & DP83822_PCS_STAT1_RX_LPI_IND) != 0U;
+    status->txLpi         = (pcsStatus & DP83822_PCS_STAT1_TX_LPI_IND) != 0U;
+    status->rxLpiReceived = (pcsStatus & DP83822_PCS_STAT1_RX_LPI_RCVD) != 0U;
+    status->txLpiReceived = (pcsStatus & DP83822_PCS_STAT1_TX_LPI_RCVD) != 0U;
+    status->errorEvents   = ((phy_dp83825_resource_t *)handle->resource)->eeeErrorEvents;
+    status->wakeTimeUs    = status->active ? DP83822_EEE_WAKE_100TX_US : 0U;
+    return result;
+}
+#endif
+
+status_t PHY_DP83825_EnableEnergyDetect(phy_handle_t *handle, bool enable, uint16_t idlePolls)
+{
+    phy_dp83825_energy_detect_t *energy = &((phy_dp83825_resource_t *)handle->resource)->energy;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    if (enable && ((phy_dp83825_resource_t *)handle->resource)->fiber)
+    {
+        /* Fiber has no line energy, the signal detect input does the job. */
+        return kStatus_InvalidArgument;
+    }
+    if (enable)
+    {
+        result = PHY_DP83825_RunScript(handle, s_energyDetectEnableScript,
+                                       PHY_SCRIPT_COUNT(s_energyDetectEnableScript));
+    }
+    else
+    {
+        result = PHY_DP83825_RunScript(handle, s_energyDetectDisableScript,
+                                       PHY_SCRIPT_COUNT(s_energyDetectDisableScript));
+    }
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+
+    energy->enabled     = enable;
+    energy->idlePolls   = idlePolls;
+    energy->pollCount   = 0U;
+    energy->poweredDown = false;
+    energy->waking      = false;
+    return result;
+}
+
+void PHY_DP83825_GetEnergyDetectStats(phy_handle_t *handle, phy_dp83825_energy_stats_t *stats)
+{
+    assert(stats);
+
+    *stats = ((phy_dp83825_resource_t *)handle->resource)->energy.stats;
+}
+
+void PHY_DP83825_SetWatchdogConfig(phy_handle_t *handle, const phy_dp83825_watchdog_config_t *config)
+{
+    assert(config);
+
+    phy_dp83825_watchdog_t *watchdog = &((phy_dp83825_resource_t *)handle->resource)->watchdog;
+
+    (void)memset(watchdog, 0, sizeof(*watchdog));
+    watchdog->config = *config;
+}
+
+void PHY_DP83825_GetHangStatus(phy_handle_t *handle, phy_dp83825_hang_t *hang, phy_dp83825_recovery_stats_t *stats)
+{
+    assert(hang);
+
+    phy_dp83825_watchdog_t *watchdog = &((phy_dp83825_resource_t *)handle->resource)->watchdog;
+
+    *hang = watchdog->hang;
+    if (stats != NULL)
+    {
+        *stats = watchdog->stats;
+    }
+}
+
+static status_t PHY_DP83825_CheckId(phy_handle_t *handle)
 {
-    assert((type == kPHY_IntrActiveLow) || (type == kPHY_IntrActiveHigh));
-
     status_t result;
-    uint16_t regValue;
+    uint32_t phyID;
 
-    result = PHY_DP83825_READ(handle, MII_DP83822_MISR1, &regValue);
+    result = PHY_DP83825_ReadId(handle, &phyID);
+    if ((result == kStatus_Success) && (phyID != ((phy_dp83825_resource_t *)handle->resource)->phyId))
+    {
+        result = kStatus_Fail;
+    }
+    return result;
+}
+
+static status_t PHY_DP83825_ResetCtrl(phy_handle_t *handle, const phy_dp83825_script_t *script, uint32_t count)
+{
+    status_t result;
+
+    result = PHY_DP83825_RunScript(handle, script, count);
     if (result == kStatus_Success)
     {
-        /* Enable/Disable link up+down interrupt. */
-        if (enable)
+        result = PHY_DP83825_CheckId(handle);
+    }
+    return result;
+}
+
+status_t PHY_DP83825_Recover(phy_handle_t *handle)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_watchdog_t *watchdog = &resource->watchdog;
+    uint32_t start                   = PHY_DP83825_GetTimeUs(handle);
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    /* A soft reset restarts the PHY state machines and keeps the registers, a hard reset
+       returns everything to the strap defaults. Try the cheaper one first. */
+    watchdog->stats.softResets++;
+    result = PHY_DP83825_ResetCtrl(handle, s_softResetScript, PHY_SCRIPT_COUNT(s_softResetScript));
+    if (result != kStatus_Success)
+    {
+        watchdog->stats.hardResets++;
+        result = PHY_DP83825_ResetCtrl(handle, s_hardResetScript, PHY_SCRIPT_COUNT(s_hardResetScript));
+    }
+
+    /* Both resets leave the PHY ready, no need for another BMCR reset. */
+    if (result == kStatus_Success)
+    {
+        resource->callDepth++;
+        result = PHY_DP83825_Configure(handle, &resource->config, false);
+        resource->callDepth--;
+    }
+
+    if (result == kStatus_Success)
+    {
+        watchdog->hang         = kPHY_DP83825_HangNone;
+        watchdog->busErrors    = 0U;
+        watchdog->autoNegPolls = 0U;
+        watchdog->verifyPolls  = 0U;
+    }
+    else
+    {
+        watchdog->stats.failedRecoveries++;
+    }
+
+    watchdog->stats.lastRecoveryUs = PHY_DP83825_GetTimeUs(handle) - start;
+    if (watchdog->stats.lastRecoveryUs > watchdog->stats.maxRecoveryUs)
+    {
+        watchdog->stats.maxRecoveryUs = watchdog->stats.lastRecoveryUs;
+    }
+    return result;
+}
+
+#if PHY_DP83825_ENABLE_TELEMETRY
+void PHY_DP83825_GetTimeline(phy_handle_t *handle, phy_dp83825_timeline_t *timeline)
+{
+    assert(timeline);
+
+    *timeline = ((phy_dp83825_resource_t *)handle->resource)->timing.timeline;
+}
+
+void PHY_DP83825_GetPhaseStats(phy_handle_t *handle, phy_dp83825_phase_stats_t *stats)
+{
+    assert(stats);
+
+    phy_dp83825_link_timing_t *timing = &((phy_dp83825_resource_t *)handle->resource)->timing;
+    uint32_t index;
+
+    *stats = timing->stats;
+    for (index = 0U; index < (uint32_t)kPHY_DP83825_PhaseCount; index++)
+    {
+        stats->avgUs[index] =
+            (stats->count[index] != 0U) ? (uint32_t)(timing->totalUs[index] / stats->count[index]) : 0U;
+    }
+}
+
+void PHY_DP83825_ClearPhaseStats(phy_handle_t *handle)
+{
+    phy_dp83825_link_timing_t *timing = &((phy_dp83825_resource_t *)handle->resource)->timing;
+
+    (void)memset(&timing->stats, 0, sizeof(timing->stats));
+    (void)memset(timing->totalUs, 0, sizeof(timing->totalUs));
+}
+#endif
+
+static phy_dp83825_hang_t PHY_DP83825_WatchdogCheck(phy_handle_t *handle, status_t result, uint16_t bstatus)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    phy_dp83825_watchdog_t *watchdog = &resource->watchdog;
+    uint16_t regValue;
+
+    /* Bus level: failed frames or a floating/shorted MDIO line. BMSR always has ability bits set
+       and never reads as all ones on these PHYs. */
+    if ((result != kStatus_Success) || (bstatus == PHY_DP83825_BUS_STUCK_HIGH) ||
+        (bstatus == PHY_DP83825_BUS_STUCK_LOW))
+    {
+        watchdog->busErrors++;
+        if ((watchdog->config.busErrorLimit != 0U) && (watchdog->busErrors >= watchdog->config.busErrorLimit))
         {
-            regValue |= DP83822_LINK_STAT_INT_EN;
+            return kPHY_DP83825_HangBus;
         }
-        else
+        return kPHY_DP83825_HangNone;
+    }
+    watchdog->busErrors = 0U;
+
+    /* PHY level: auto-negotiation pending although the line carries a signal. Only pay for the
+       PHYSTS read once the limit is reached, a missing cable is not a hang. */
+    if (resource->config.autoNeg && ((bstatus & PHY_BSTATUS_AUTONEGCOMP_MASK) == 0U))
+    {
+        watchdog->autoNegPolls++;
+        if ((watchdog->config.autoNegLimit != 0U) && (watchdog->autoNegPolls >= watchdog->config.autoNegLimit))
         {
-            regValue &= ~DP83822_LINK_STAT_INT_EN;
+            watchdog->autoNegPolls = 0U;
+            if ((PHY_DP83825_READ(handle, MII_DP83822_PHYSTS, &regValue) == kStatus_Success) &&
+                ((regValue & DP83822_PHYSTS_SIGNAL_DETECT) != 0U))
+            {
+                return kPHY_DP83825_HangAutoNeg;
+            }
         }
-        result = PHY_DP83825_WRITE(handle, MII_DP83822_MISR1, regValue);
     }
-    if (result != kStatus_Success)
+    else
     {
-        return result;
+        watchdog->autoNegPolls = 0U;
     }
-    result = PHY_DP83825_READ(handle, MII_DP83822_PHYSCR, &regValue);
-    if (result == kStatus_Success)
+
+    /* Configuration lost: the PHY answers but was reset behind our back. */
+    if (watchdog->config.verifyInterval != 0U)
     {
-        /* Enable/Disable link up+down interrupt. */
-        if (enable)
+        watchdog->verifyPolls++;
+        if (watchdog->verifyPolls >= watchdog->config.verifyInterval)
         {
-            regValue |= DP83822_PHYSCR_INTEN;
-            regValue |= DP83822_PHYSCR_INT_OE;
+            watchdog->verifyPolls = 0U;
+            if (PHY_DP83825_CheckId(handle) != kStatus_Success)
+            {
+                return kPHY_DP83825_HangBus;
+            }
+            /* The elastic buffer underflow/overflow status bits follow the RX traffic, not the configuration. */
+            if ((PHY_DP83825_READ(handle, MII_DP83822_RCSR, &regValue) != kStatus_Success) ||
+                ((regValue & (uint16_t)~s_shadowVolatile[kPHY_DP83825_ShadowRcsr]) != resource->rcsr))
+            {
+                return kPHY_DP83825_HangConfigLost;
+            }
         }
-        else
+    }
+    return kPHY_DP83825_HangNone;
+}
+
+static void PHY_DP83825_WatchdogObserve(phy_handle_t *handle, status_t result, uint16_t bstatus)
+{
+    phy_dp83825_watchdog_t *watchdog = &((phy_dp83825_resource_t *)handle->resource)->watchdog;
+    phy_dp83825_hang_t hang;
+
+    if (watchdog->hang != kPHY_DP83825_HangNone)
+    {
+        /* Already reported, waiting for PHY_DP83825_Recover(). */
+        return;
+    }
+
+    hang = PHY_DP83825_WatchdogCheck(handle, result, bstatus);
+    if (hang != kPHY_DP83825_HangNone)
+    {
+        watchdog->hang           = hang;
+        watchdog->stats.lastHang = hang;
+        watchdog->stats.hangs++;
+        if (watchdog->config.autoRecover)
+        {
+            (void)PHY_DP83825_Recover(handle);
+        }
+    }
+}
+
+static status_t PHY_DP83825_ShadowRead(phy_handle_t *handle, uint16_t *values)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+    status_t result                  = kStatus_Success;
+    uint32_t index;
+
+    for (index = 0U; (index < PHY_DP83825_SHADOW_COUNT) && (result == kStatus_Success); index++)
+    {
+        if ((resource->shadow.valid & (1U << index)) == 0U)
         {
-            regValue &= ~DP83822_PHYSCR_INTEN;
-            regValue &= ~DP83822_PHYSCR_INT_OE;
+            /* The read refreshes the shadow. */
+            result = PHY_DP83825_READ(handle, s_shadowRegs[index], &values[index]);
         }
-        result = PHY_DP83825_WRITE(handle, MII_DP83822_MISR1, regValue);
+        values[index] = resource->shadow.value[index];
+    }
+    return result;
+}
+
+/* BMCR speed and duplex bits a loopback point forces on top of the configured ones. */
+static uint16_t PHY_DP83825_LoopbackForced(phy_dp83825_loopback_t loopback)
+{
+    if (loopback == kPHY_DP83825_LoopbackNone)
+    {
+        return 0U;
     }
+    /* Half duplex would see its own looped frames as collisions. */
+    if ((loopback == kPHY_DP83825_LoopbackReverse) || (loopback == kPHY_DP83825_LoopbackPcsIn) ||
+        (loopback == kPHY_DP83825_LoopbackPcsOut))
+    {
+        /* These points are on the 100BASE-TX path. */
+        return PHY_BCTL_DUPLEX_MASK | PHY_BCTL_SPEED0_MASK;
+    }
+    return PHY_BCTL_DUPLEX_MASK;
+}
+
+status_t PHY_DP83825_ApplyConfig(phy_handle_t *handle, const phy_dp83825_config_t *config)
+{
+    assert(config);
+    /* This PHY only supports 10/100M speed. */
+    assert(config->speed <= kPHY_Speed100M);
+
+    phy_dp83825_script_t script[PHY_DP83825_SHADOW_COUNT];
+    uint16_t current[PHY_DP83825_SHADOW_COUNT];
+    uint16_t target[PHY_DP83825_SHADOW_COUNT];
+    uint16_t forced;
+    uint32_t count = 0U;
+    uint32_t index;
+    status_t result;
+
+    PHY_DP83825_BeginCall(handle);
+
+    result = PHY_DP83825_ShadowRead(handle, current);
     if (result != kStatus_Success)
     {
         return result;
     }
 
-    return result;
+    forced = ((config->speed == kPHY_Speed100M) ? PHY_BCTL_SPEED0_MASK : 0U) |
+             ((config->duplex == kPHY_FullDuplex) ? PHY_BCTL_DUPLEX_MASK : 0U);
+    if (((phy_dp83825_resource_t *)handle->resource)->fiber)
+    {
+        /* 100BASE-FX only runs 100M full duplex, without auto-negotiation. */
+        forced = PHY_BCTL_SPEED0_MASK | PHY_BCTL_DUPLEX_MASK;
+    }
+    forced |= PHY_DP83825_LoopbackForced(config->loopback);
+
+    (void)memcpy(target, current, sizeof(target));
+    target[kPHY_DP83825_ShadowRcsr]  = config->rcsr;
+    target[kPHY_DP83825_ShadowMisr1] = (uint16_t)FIELD_GET(PHY_DP83825_INT_MISR1_MASK, config->interruptMask);
+    target[kPHY_DP83825_ShadowMisr2] = (uint16_t)FIELD_GET(PHY_DP83825_INT_MISR2_MASK, config->interruptMask);
+    target[kPHY_DP83825_ShadowPhyscr] =
+        (uint16_t)FIELD_MODIFY(DP83822_PHYSCR_INTEN, target[kPHY_DP83825_ShadowPhyscr], config->interruptMask != 0U);
+    target[kPHY_DP83825_ShadowPhyscr] =
+        (uint16_t)FIELD_MODIFY(DP83822_PHYSCR_INT_OE, target[kPHY_DP83825_ShadowPhyscr], config->interruptMask != 0U);
+    target[kPHY_DP83825_ShadowPhycr] = (uint16_t)FIELD_MODIFY(
+        DP83822_MDIX_AUTO_EN, target[kPHY_DP83825_ShadowPhycr], config->mdix == kPHY_DP83825_MdixAuto);
+    target[kPHY_DP83825_ShadowPhycr] = (uint16_t)FIELD_MODIFY(
+        DP83822_MDIX_FORCE_CROSS, target[kPHY_DP83825_ShadowPhycr], config->mdix == kPHY_DP83825_MdixForced);
+    target[kPHY_DP83825_ShadowAnar]  = config->advertise | PHY_IEEE802_3_SELECTOR_MASK;
+    target[kPHY_DP83825_ShadowBiscr] = (uint16_t)FIELD_MODIFY(
+        DP83822_BISCR_LOOPBACKMODE_MASK, target[kPHY_DP83825_ShadowBiscr], s_loopbackBiscr[config->loopback]);
+    target[kPHY_DP83825_ShadowBmcr] &= (uint16_t)~(PHY_BCTL_LOOP_MASK | PHY_BCTL_AUTONEG_MASK | PHY_BCTL_SPEED0_MASK |
+                                                   PHY_BCTL_DUPLEX_MASK | PHY_BCTL_ISOLATE_MASK);
+    if (config->loopback == kPHY_DP83825_LoopbackLocal)
+    {
+        target[kPHY_DP83825_ShadowBmcr] |= PHY_BCTL_LOOP_MASK | forced;
+    }
+    else if ((config->loopback == kPHY_DP83825_LoopbackNone) && config->autoNeg &&
+             !((phy_dp83825_resource_t *)handle->resource)->fiber)
+    {
+        target[kPHY_DP83825_ShadowBmcr] |= PHY_BCTL_AUTONEG_MASK;
+    }
+    else
+    {
+        target[kPHY_DP83825_ShadowBmcr] |= forced;
+    }
+
+    for (index = 0U; index < PHY_DP83825_SHADOW_COUNT; index++)
+    {
+        if (target[index] != current[index])
+        {
+            script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_WRITE(s_shadowRegs[index], target[index]);
+        }
+    }
+
+    /* Renegotiate only when auto-negotiation gets enabled or the advertisement changes. */
+    if (((target[kPHY_DP83825_ShadowBmcr] & PHY_BCTL_AUTONEG_MASK) != 0U) &&
+        (((current[kPHY_DP83825_ShadowBmcr] & PHY_BCTL_AUTONEG_MASK) == 0U) ||
+         (target[kPHY_DP83825_ShadowAnar] != current[kPHY_DP83825_ShadowAnar])))
+    {
+        if ((count == 0U) || (script[count - 1U].reg != PHY_BASICCONTROL_REG))
+        {
+            script[count++] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_WRITE(PHY_BASICCONTROL_REG,
+                                                                             target[kPHY_DP83825_ShadowBmcr]);
+        }
+        script[count - 1U].value |= PHY_BCTL_RESTART_AUTONEG_MASK;
+    }
+
+    return PHY_DP83825_RunScript(handle, script, count);
 }
 
-status_t PHY_DP83825_ClearInterrupt(phy_handle_t *handle)
+status_t PHY_DP83825_GetConfig(phy_handle_t *handle, phy_dp83825_config_t *config)
 {
-    uint16_t regValue;
+    assert(config);
+
+    uint16_t current[PHY_DP83825_SHADOW_COUNT];
+    uint32_t index;
+    uint16_t bmcr;
     status_t result;
 
-    result = PHY_DP83825_READ(handle, MII_DP83822_MISR1, &regValue);
+    PHY_DP83825_BeginCall(handle);
+
+    result = PHY_DP83825_ShadowRead(handle, current);
     if (result != kStatus_Success)
     {
         return result;
     }
-    result = PHY_DP83825_READ(handle, MII_DP83822_MISR2, &regValue);
 
+    bmcr              = current[kPHY_DP83825_ShadowBmcr];
+    config->autoNeg   = (bmcr & PHY_BCTL_AUTONEG_MASK) != 0U;
+    config->advertise = current[kPHY_DP83825_ShadowAnar] & (uint16_t)~PHY_IEEE802_3_SELECTOR_MASK;
+    config->speed     = ((bmcr & PHY_BCTL_SPEED0_MASK) != 0U) ? kPHY_Speed100M : kPHY_Speed10M;
+    config->duplex    = ((bmcr & PHY_BCTL_DUPLEX_MASK) != 0U) ? kPHY_FullDuplex : kPHY_HalfDuplex;
+    if ((current[kPHY_DP83825_ShadowPhycr] & DP83822_MDIX_AUTO_EN) != 0U)
+    {
+        config->mdix = kPHY_DP83825_MdixAuto;
+    }
+    else if ((current[kPHY_DP83825_ShadowPhycr] & DP83822_MDIX_FORCE_CROSS) != 0U)
+    {
+        config->mdix = kPHY_DP83825_MdixForced;
+    }
+    else
+    {
+        config->mdix = kPHY_DP83825_MdiForced;
+    }
+    config->interruptMask = 0U;
+    if ((current[kPHY_DP83825_ShadowPhyscr] & DP83822_PHYSCR_INTEN) != 0U)
+    {
+        config->interruptMask = (uint16_t)(FIELD_PREP(PHY_DP83825_INT_MISR1_MASK, current[kPHY_DP83825_ShadowMisr1]) |
+                                           FIELD_PREP(PHY_DP83825_INT_MISR2_MASK, current[kPHY_DP83825_ShadowMisr2]));
+    }
+    config->rcsr = current[kPHY_DP83825_ShadowRcsr];
+    if ((bmcr & PHY_BCTL_LOOP_MASK) != 0U)
+    {
+        config->loopback = kPHY_DP83825_LoopbackLocal;
+    }
+    else
+    {
+        config->loopback = kPHY_DP83825_LoopbackNone;
+        for (index = (uint32_t)kPHY_DP83825_LoopbackReverse; index < (uint32_t)kPHY_DP83825_LoopbackCount; index++)
+        {
+            if (FIELD_GET(DP83822_BISCR_LOOPBACKMODE_MASK, current[kPHY_DP83825_ShadowBiscr]) == s_loopbackBiscr[index])
+            {
+                config->loopback = (phy_dp83825_loopback_t)index;
+                break;
+            }
+        }
+    }
     return result;
 }
+
+static bool PHY_DP83825_ScriptMergeable(const phy_dp83825_script_t *first, const phy_dp83825_script_t *next)
+{
+    uint8_t op = next->op & (uint8_t)~PHY_DP83825_SCRIPT_EXT;
+
+    return ((op == (uint8_t)kPHY_DP83825_ScriptWrite) || (op == (uint8_t)kPHY_DP83825_ScriptModify)) &&
+           ((next->op & PHY_DP83825_SCRIPT_EXT) == (first->op & PHY_DP83825_SCRIPT_EXT)) && (next->reg == first->reg);
+}
+
+/* Sets up the frame of the next entries, or finishes the run. */
+static void PHY_DP83825_ScriptNext(phy_dp83825_script_run_t *run)
+{
+    const phy_dp83825_script_t *entry;
+    uint8_t op;
+
+    while (run->index < run->count)
+    {
+        entry        = &run->script[run->index];
+        op           = entry->op & (uint8_t)~PHY_DP83825_SCRIPT_EXT;
+        run->devAddr = ((entry->op & PHY_DP83825_SCRIPT_EXT) != 0U) ? DP83822_DEVADDR : 0U;
+        run->reg     = entry->reg;
+
+        if (op == (uint8_t)kPHY_DP83825_ScriptIfPhyId)
+        {
+            if (((uint16_t)run->phyId & entry->mask) != entry->value)
+            {
+                run->index += entry->arg;
+            }
+            run->index++;
+            continue;
+        }
+        if (op == (uint8_t)kPHY_DP83825_ScriptWait)
+        {
+            run->wait   = true;
+            run->mask   = entry->mask;
+            run->expect = entry->value;
+            run->polls  = ((uint32_t)entry->arg * 1000U) / PHY_SCRIPT_POLL_US;
+            run->action = kPHY_DP83825_ScriptActionRead;
+            run->index++;
+            return;
+        }
+
+        /* Fold the run of write/modify entries on this register into one mask/value pair. */
+        run->wait    = false;
+        run->written = false;
+        run->mask    = 0U;
+        run->expect  = 0U;
+        while ((run->index < run->count) && PHY_DP83825_ScriptMergeable(entry, &run->script[run->index]))
+        {
+            if ((run->script[run->index].op & (uint8_t)~PHY_DP83825_SCRIPT_EXT) == (uint8_t)kPHY_DP83825_ScriptWrite)
+            {
+                run->written = true;
+            }
+            run->expect = (run->expect & (uint16_t)~run->script[run->index].mask) |
+                          (run->script[run->index].value & run->script[run->index].mask);
+            run->mask |= run->script[run->index].mask;
+            run->index++;
+        }
+
+        /* Only read back the bits the script does not define. */
+        run->value  = run->expect;
+        run->action = (run->mask != 0xFFFFU) ? kPHY_DP83825_ScriptActionRead : kPHY_DP83825_ScriptActionWrite;
+        return;
+    }
+    run->status = kStatus_Success;
+    run->action = kPHY_DP83825_ScriptActionDone;
+}
+
+void PHY_DP83825_ScriptStart(phy_dp83825_script_run_t *run,
+                             const phy_dp83825_script_t *script,
+                             uint32_t count,
+                             uint32_t phyId)
+{
+    assert(run);
+    assert((script != NULL) || (count == 0U));
+
+    (void)memset(run, 0, sizeof(*run));
+    run->script = script;
+    run->count  = count;
+    run->phyId  = phyId;
+    PHY_DP83825_ScriptNext(run);
+}
+
+phy_dp83825_script_action_t PHY_DP83825_ScriptStep(phy_dp83825_script_run_t *run, status_t status, uint16_t data)
+{
+    assert(run);
+
+    switch (run->action)
+    {
+        case kPHY_DP83825_ScriptActionRead:
+            if (run->wait)
+            {
+                if ((status == kStatus_Success) && ((data & run->mask) == run->expect))
+                {
+                    PHY_DP83825_ScriptNext(run);
+                }
+                else if (run->polls == 0U)
+                {
+                    run->status = (status != kStatus_Success) ? status : kStatus_Timeout;
+                    run->action = kPHY_DP83825_ScriptActionDone;
+                }
+                else
+                {
+                    run->polls--;
+                    run->delayUs = PHY_SCRIPT_POLL_US;
+                    run->action  = kPHY_DP83825_ScriptActionDelay;
+                }
+            }
+            else if (status != kStatus_Success)
+            {
+                run->status = status;
+                run->action = kPHY_DP83825_ScriptActionDone;
+            }
+            else if (!run->written && ((data & run->mask) == run->expect))
+            {
+                /* The modify does not change the register. */
+                PHY_DP83825_ScriptNext(run);
+            }
+            else
+            {
+                run->value  = run->expect | (data & (uint16_t)~run->mask);
+                run->action = kPHY_DP83825_ScriptActionWrite;
+            }
+            break;
+        case kPHY_DP83825_ScriptActionWrite:
+            if (status != kStatus_Success)
+            {
+                run->status = status;
+                run->action = kPHY_DP83825_ScriptActionDone;
+            }
+            else
+            {
+                PHY_DP83825_ScriptNext(run);
+            }
+            break;
+        case kPHY_DP83825_ScriptActionDelay:
+            run->action = kPHY_DP83825_ScriptActionRead;
+            break;
+        default:
+            break;
+    }
+    return run->action;
+}
+
+uint32_t PHY_DP83825_GetLoopbackScript(phy_dp83825_loopback_t loopback,
+                                       phy_speed_t speed,
+                                       phy_dp83825_script_t *script)
+{
+    assert(loopback < kPHY_DP83825_LoopbackCount);
+    assert(script);
+
+    uint16_t bmcr = PHY_DP83825_LoopbackForced(loopback);
+
+    script[0] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_MODIFY(MII_DP83822_BISCR, DP83822_BISCR_LOOPBACKMODE_MASK,
+                                                                s_loopbackBiscr[loopback]);
+    if (loopback == kPHY_DP83825_LoopbackNone)
+    {
+        script[1] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_CLEAR(PHY_BASICCONTROL_REG, PHY_BCTL_LOOP_MASK);
+        return PHY_DP83825_LOOPBACK_SCRIPT_COUNT;
+    }
+
+    if (speed == kPHY_Speed100M)
+    {
+        bmcr |= PHY_BCTL_SPEED0_MASK;
+    }
+    if (loopback == kPHY_DP83825_LoopbackLocal)
+    {
+        bmcr |= PHY_BCTL_LOOP_MASK;
+    }
+    script[1] = (phy_dp83825_script_t)PHY_DP83825_SCRIPT_MODIFY(
+        PHY_BASICCONTROL_REG, PHY_BCTL_LOOP_MASK | PHY_BCTL_AUTONEG_MASK | PHY_BCTL_SPEED0_MASK | PHY_BCTL_DUPLEX_MASK,
+        bmcr);
+    return PHY_DP83825_LOOPBACK_SCRIPT_COUNT;
+}
+
+const phy_dp83825_script_t *PHY_DP83825_GetScript(phy_dp83825_script_id_t id, uint32_t phyId, uint32_t *count)
+{
+    assert(count);
+
+    const phy_dp83825_variant_desc_t *desc;
+
+    switch (id)
+    {
+        case kPHY_DP83825_ScriptIdReset:
+            *count = PHY_SCRIPT_COUNT(s_resetScript);
+            return s_resetScript;
+        case kPHY_DP83825_ScriptIdVariantInit:
+            desc = PHY_DP83825_GetVariantDesc(PHY_DP83825_VariantFromId(phyId));
+            if (desc == NULL)
+            {
+                break;
+            }
+            *count = desc->count;
+            return desc->script;
+        case kPHY_DP83825_ScriptIdInit:
+            *count = PHY_SCRIPT_COUNT(s_initScript);
+            return s_initScript;
+        case kPHY_DP83825_ScriptIdAutoNeg:
+            *count = PHY_SCRIPT_COUNT(s_autoNegScript);
+            return s_autoNegScript;
+        case kPHY_DP83825_ScriptIdLinkIntrEnable:
+            *count = PHY_SCRIPT_COUNT(s_linkIntrEnableScript);
+            return s_linkIntrEnableScript;
+        case kPHY_DP83825_ScriptIdLinkIntrDisable:
+            *count = PHY_SCRIPT_COUNT(s_linkIntrDisableScript);
+            return s_linkIntrDisableScript;
+        default:
+            break;
+    }
+    *count = 0U;
+    return NULL;
+}
+
+status_t PHY_DP83825_RunScript(phy_handle_t *handle, const phy_dp83825_script_t *script, uint32_t count)
+{
+    assert((script != NULL) || (count == 0U));
+
+    phy_dp83825_script_run_t run;
+    status_t result;
+    uint16_t regValue;
+
+    PHY_DP83825_ScriptStart(&run, script, count, ((phy_dp83825_resource_t *)handle->resource)->phyId);
+    while (run.action != kPHY_DP83825_ScriptActionDone)
+    {
+        result   = kStatus_Success;
+        regValue = 0U;
+        if (run.action == kPHY_DP83825_ScriptActionRead)
+        {
+            result = (run.devAddr != 0U) ? PHY_DP83825_EXTREAD(handle, run.devAddr, run.reg, &regValue) :
+                                           PHY_DP83825_READ(handle, run.reg, &regValue);
+        }
+        else if (run.action == kPHY_DP83825_ScriptActionWrite)
+        {
+            result = (run.devAddr != 0U) ? PHY_DP83825_EXTWRITE(handle, run.devAddr, run.reg, run.value) :
+                                           PHY_DP83825_WRITE(handle, run.reg, run.value);
+        }
+        else
+        {
+            PHY_DP83825_Delay(handle, run.delayUs);
+        }
+        (void)PHY_DP83825_ScriptStep(&run, result, regValue);
+    }
+    return run.status;
+}
+
+void PHY_DP83825_SetRetryPolicy(phy_handle_t *handle, const phy_dp83825_retry_policy_t *policy)
+{
+    assert(policy);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+
+    resource->retryPolicy = *policy;
+    (void)memset(&resource->retryStats, 0, sizeof(resource->retryStats));
+}
+
+void PHY_DP83825_GetRetryStats(phy_handle_t *handle, phy_dp83825_retry_stats_t *stats)
+{
+    assert(stats);
+
+    *stats = ((phy_dp83825_resource_t *)handle->resource)->retryStats;
+}
@@ -16,15 +16,677 @@
 /*! @brief PHY driver version */
 #define FSL_PHY_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
 
+/*! @brief Defines the PHY variants supported by the build, all enabled by default. */
+#ifndef PHY_DP83825_ENABLE_DP83822
+#define PHY_DP83825_ENABLE_DP83822 (1)
+#endif
+#ifndef PHY_DP83825_ENABLE_DP83825
+#define PHY_DP83825_ENABLE_DP83825 (1)
+#endif
+#ifndef PHY_DP83825_ENABLE_DP83826
+#define PHY_DP83825_ENABLE_DP83826 (1)
+#endif
+#if !(PHY_DP83825_ENABLE_DP83822 || PHY_DP83825_ENABLE_DP83825 || PHY_DP83825_ENABLE_DP83826)
+#error "At least one PHY variant must be enabled."
+#endif
+
+/*!
+ * @brief Defines the feature groups supported by the build, all enabled by default.
+ *
+ * A disabled group leaves its functions and state out, the phy_operations_t entries stay valid.
+ * Extended registers carry the EEE, checkpoint, DP83822 fiber and DP83826 VOD support. Wake on LAN
+ * and the diagnostics follow the groups they are built on unless set explicitly.
+ */
+#ifndef PHY_DP83825_ENABLE_EXT
+#define PHY_DP83825_ENABLE_EXT (1)
+#endif
+#ifndef PHY_DP83825_ENABLE_LOOPBACK
+#define PHY_DP83825_ENABLE_LOOPBACK (1)
+#endif
+#ifndef PHY_DP83825_ENABLE_WOL
+#define PHY_DP83825_ENABLE_WOL (PHY_DP83825_ENABLE_EXT)
+#endif
+#ifndef PHY_DP83825_ENABLE_DIAGNOSTICS
+#define PHY_DP83825_ENABLE_DIAGNOSTICS (PHY_DP83825_ENABLE_EXT && PHY_DP83825_ENABLE_LOOPBACK)
+#endif
+#ifndef PHY_DP83825_ENABLE_TELEMETRY
+#define PHY_DP83825_ENABLE_TELEMETRY (1)
+#endif
+
+#if PHY_DP83825_ENABLE_WOL && !PHY_DP83825_ENABLE_EXT
+#error "Wake on LAN needs PHY_DP83825_ENABLE_EXT."
+#endif
+#if PHY_DP83825_ENABLE_DIAGNOSTICS && !(PHY_DP83825_ENABLE_EXT && PHY_DP83825_ENABLE_LOOPBACK)
+#error "The diagnostics need PHY_DP83825_ENABLE_EXT and PHY_DP83825_ENABLE_LOOPBACK."
+#endif
+
+/*! @brief Defines the PHY variants. */
+typedef enum _phy_dp83825_variant
+{
+    kPHY_DP83825_VariantUnknown = 0U, /*!< PHY not detected yet. */
+    kPHY_DP83825_VariantDP83822,      /*!< DP83822, MII/RMII/RGMII and 100BASE-FX fiber. */
+    kPHY_DP83825_VariantDP83825,      /*!< DP83825S/I/CM/CS, RMII only. */
+    kPHY_DP83825_VariantDP83826,      /*!< DP83826C/NC, MII/RMII with VOD configuration. */
+} phy_dp83825_variant_t;
+
+/*! @brief Defines the MDI/MDI-X configuration. */
+typedef enum _phy_dp83825_mdix
+{
+    kPHY_DP83825_MdixAuto = 0U, /*!< Automatic MDI/MDI-X crossover. */
+    kPHY_DP83825_MdiForced,     /*!< Forced MDI. */
+    kPHY_DP83825_MdixForced,    /*!< Forced MDI-X. */
+} phy_dp83825_mdix_t;
+
+/*! @brief Defines the PHY loopback configuration. */
+typedef enum _phy_dp83825_loopback
+{
+    kPHY_DP83825_LoopbackNone = 0U, /*!< Normal operation. */
+    kPHY_DP83825_LoopbackLocal,     /*!< BMCR local loopback, MAC data returned at the MII. */
+    kPHY_DP83825_LoopbackReverse,   /*!< Reverse loopback, line data returned to the link partner. */
+    kPHY_DP83825_LoopbackPcsIn,     /*!< BISCR PCS input loopback, 100M only. */
+    kPHY_DP83825_LoopbackPcsOut,    /*!< BISCR PCS output loopback, 100M only. */
+    kPHY_DP83825_LoopbackDigital,   /*!< BISCR digital loopback, in front of the analog front end. */
+    kPHY_DP83825_LoopbackAnalog,    /*!< BISCR analog loopback, needs a terminated line or loopback plug. */
+    kPHY_DP83825_LoopbackCount,     /*!< Number of loopback points. */
+} phy_dp83825_loopback_t;
+
+/*! @brief Defines the full PHY configuration used by PHY_DP83825_ApplyConfig(). */
+typedef struct _phy_dp83825_config
+{
+    bool autoNeg;                    /*!< Auto-negotiation, true: enable, false: use speed and duplex. */
+    uint16_t advertise;              /*!< Advertised abilities, PHY_100BASETX_FULLDUPLEX_MASK etc. */
+    phy_speed_t speed;               /*!< Forced speed, used without auto-negotiation and in loopback. */
+    phy_duplex_t duplex;             /*!< Forced duplex, used without auto-negotiation and in loopback. */
+    phy_dp83825_mdix_t mdix;         /*!< MDI/MDI-X configuration. */
+    uint16_t interruptMask;          /*!< MISR1 enable bits in 7:0, MISR2 enable bits in 15:8, 0 disables the INT pin. */
+    uint16_t rcsr;                   /*!< RMII and elastic buffer configuration, RCSR register value. */
+    phy_dp83825_loopback_t loopback; /*!< Loopback configuration. */
+} phy_dp83825_config_t;
+
+/*! @brief Defines the Wake on Lan configuration. */
+typedef struct _phy_dp83825_wol_config
+{
+    uint8_t macAddr[6];  /*!< Destination MAC address of the magic packet, in transmission order. */
+    bool magic;          /*!< Wake on magic packet. */
+    bool secureOn;       /*!< Require the SecureOn password after the magic packet. */
+    uint8_t password[6]; /*!< SecureOn password, in transmission order. */
+} phy_dp83825_wol_config_t;
+
+/*! @brief Defines the number of configuration registers shadowed by the driver. */
+#define PHY_DP83825_SHADOW_COUNT (8U)
+
+/*! @brief Defines the shadow of the configuration registers, avoiding read-back before writes. */
+typedef struct _phy_dp83825_shadow
+{
+    uint16_t value[PHY_DP83825_SHADOW_COUNT]; /*!< Last known register values, volatile bits cleared. */
+    uint16_t valid;                           /*!< Bit mask of the valid values. */
+} phy_dp83825_shadow_t;
+
+/*! @brief Microsecond time source, used to report recovery and bring-up times. */
+typedef uint32_t (*phyGetTimeUs)(void);
+
+/*! @brief Microsecond delay, used for the MDIO retry backoff. */
+typedef void (*phyDelayUs)(uint32_t delayUs);
+
+/*! @brief MDIO access on a bus, context is the one of the bus. */
+typedef status_t (*phyBusWrite)(void *context, uint8_t phyAddr, uint8_t regAddr, uint16_t data);
+typedef status_t (*phyBusRead)(void *context, uint8_t phyAddr, uint8_t regAddr, uint16_t *pData);
+typedef status_t (*phyBusWriteExt)(void *context, uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data);
+typedef status_t (*phyBusReadExt)(void *context, uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData);
+
+/*! @brief Takes or releases the bus for one MDIO frame. */
+typedef void (*phyBusLock)(void *lockContext);
+
+/*! @brief Defines an MDIO bus, shared by the PHYs on one MAC.
+ *
+ * Replaces the resource read/write functions, which take no context, so every MAC can carry its
+ * own bus. The lock is only needed when more than one task issues frames on the bus.
+ */
+typedef struct _phy_dp83825_bus
+{
+    phyBusWrite write;
+    phyBusRead read;
+    phyBusWriteExt writeExt;
+    phyBusReadExt readExt;
+    void *context;     /*!< Passed to the bus functions, for example the ENET peripheral. */
+    phyBusLock lock;   /*!< Optional, taken around each frame, NULL if only one task uses the bus. */
+    phyBusLock unlock; /*!< Optional, releases lock. */
+    void *lockContext; /*!< Passed to lock and unlock. */
+    uint8_t busId;     /*!< Bus number, instances are looked up by bus and PHY address. */
+} phy_dp83825_bus_t;
+
+/*! @brief Defines the MDIO retry and timeout policy.
+ *
+ * Applied to every MDIO frame issued by the driver. The default all zero policy issues each
+ * frame once, like the plain resource functions. Worst case latency of an API call is bounded
+ * by callDeadlineUs plus one frame: a backoff never sleeps past the deadline, and once the
+ * deadline expires no new retry is started and the call returns with the frame error. Without
+ * a deadline each retry waits at most maxBackoffUs.
+ */
+typedef struct _phy_dp83825_retry_policy
+{
+    uint32_t opTimeoutUs;    /*!< Frames taking longer are treated as timed out, 0 disables. Needs getTimeUs. */
+    uint32_t backoffUs;      /*!< Delay before the first retry, doubled for each further retry. */
+    uint32_t maxBackoffUs;   /*!< Upper bound of the doubled delay, 0 only stops it at UINT32_MAX. */
+    uint32_t callDeadlineUs; /*!< No retry is started once the API call has run this long, 0 disables. */
+    uint8_t maxRetries;      /*!< Retries per frame after the first attempt. */
+    bool retryStuckHigh;     /*!< Treat reads answering 0xFFFF as failed frames (MDIO stuck high). */
+} phy_dp83825_retry_policy_t;
+
+/*! @brief Defines the MDIO retry statistics. */
+typedef struct _phy_dp83825_retry_stats
+{
+    uint32_t frames;    /*!< Number of MDIO frames issued, retries included. */
+    uint32_t retries;   /*!< Number of retried frames. */
+    uint32_t timeouts;  /*!< Number of frames failed with timeout or exceeding opTimeoutUs. */
+    uint32_t failures;  /*!< Number of frames given up after all retries. */
+    uint32_t deadlines; /*!< Number of API calls which ran into callDeadlineUs. */
+} phy_dp83825_retry_stats_t;
+
+/*! @brief Defines the PHY hang conditions detected by the watchdog. */
+typedef enum _phy_dp83825_hang
+{
+    kPHY_DP83825_HangNone = 0U,  /*!< No hang detected. */
+    kPHY_DP83825_HangBus,        /*!< MDIO frames fail or the PHY answers with all ones/zeros. */
+    kPHY_DP83825_HangAutoNeg,    /*!< Signal is present but auto-negotiation never completes. */
+    kPHY_DP83825_HangConfigLost, /*!< The PHY lost the applied configuration, e.g. after an ESD event. */
+} phy_dp83825_hang_t;
+
+/*! @brief Defines the watchdog configuration.
+ *
+ * The watchdog piggybacks on PHY_DP83825_GetLinkStatus() and PHY_DP83825_GetAutoNegotiationStatus(),
+ * all limits are counted in calls to those functions. A zero limit disables the check.
+ */
+typedef struct _phy_dp83825_watchdog_config
+{
+    uint16_t busErrorLimit;  /*!< Consecutive failed or all ones/zeros status reads before a bus hang. */
+    uint16_t autoNegLimit;   /*!< Consecutive polls with signal but no auto-negotiation complete before an AN hang. */
+    uint16_t verifyInterval; /*!< Polls between checks of the PHY ID and the applied configuration. */
+    bool autoRecover;        /*!< Call PHY_DP83825_Recover() from the poll that detects the hang. */
+} phy_dp83825_watchdog_config_t;
+
+/*! @brief Defines the watchdog recovery statistics. */
+typedef struct _phy_dp83825_recovery_stats
+{
+    phy_dp83825_hang_t lastHang; /*!< Last hang condition detected. */
+    uint32_t hangs;              /*!< Number of hangs detected. */
+    uint32_t softResets;         /*!< Number of soft resets issued. */
+    uint32_t hardResets;         /*!< Number of hard resets issued. */
+    uint32_t failedRecoveries;   /*!< Number of recoveries which could not bring the PHY back. */
+    uint32_t lastRecoveryUs;     /*!< Duration of the last recovery, 0 without time source. */
+    uint32_t maxRecoveryUs;      /*!< Longest recovery duration, 0 without time source. */
+} phy_dp83825_recovery_stats_t;
+
+/*! @brief Defines the watchdog state, maintained by the driver. */
+typedef struct _phy_dp83825_watchdog
+{
+    phy_dp83825_watchdog_config_t config; /*!< Watchdog configuration. */
+    phy_dp83825_hang_t hang;              /*!< Current hang condition. */
+    uint16_t busErrors;                   /*!< Consecutive bad status reads. */
+    uint16_t autoNegPolls;                /*!< Consecutive polls without auto-negotiation complete. */
+    uint16_t verifyPolls;                 /*!< Polls since the last configuration check. */
+    phy_dp83825_recovery_stats_t stats;   /*!< Recovery statistics. */
+} phy_dp83825_watchdog_t;
+
+/*! @brief Defines the link bring-up phases, in bring-up order. */
+typedef enum _phy_dp83825_phase
+{
+    kPHY_DP83825_PhaseIdRead = 0U,     /*!< PHY ID read successfully. */
+    kPHY_DP83825_PhaseResetIssued,     /*!< PHY reset written. */
+    kPHY_DP83825_PhaseResetDone,       /*!< PHY reset read back as complete. */
+    kPHY_DP83825_PhaseAutoNegRestart,  /*!< Auto-negotiation restarted. */
+    kPHY_DP83825_PhaseAutoNegComplete, /*!< Auto-negotiation complete seen. */
+    kPHY_DP83825_PhaseLinkUp,          /*!< Link up seen. */
+    kPHY_DP83825_PhaseResolved,        /*!< Speed and duplex read with the link up. */
+    kPHY_DP83825_PhaseCount,           /*!< Number of phases. */
+} phy_dp83825_phase_t;
+
+/*! @brief Timestamps of one link bring-up.
+ *
+ * A bring-up starts at PHY_DP83825_Init(), at a reset or auto-negotiation restart following a
+ * completed bring-up, or when the link is seen going down. Phases are observed on the register
+ * accesses of the driver, so their resolution is the polling rate of the application.
+ */
+typedef struct _phy_dp83825_timeline
+{
+    uint32_t startUs;                          /*!< Bring-up start, time source microseconds. */
+    uint32_t phaseUs[kPHY_DP83825_PhaseCount]; /*!< Phase times, microseconds since startUs. */
+    uint16_t reached;                          /*!< Bit mask of the phases reached. */
+} phy_dp83825_timeline_t;
+
+/*! @brief Phase times aggregated over the completed bring-ups. */
+typedef struct _phy_dp83825_phase_stats
+{
+    uint32_t linkUps;                        /*!< Bring-ups completed. */
+    uint32_t count[kPHY_DP83825_PhaseCount]; /*!< Bring-ups having reached the phase. */
+    uint32_t minUs[kPHY_DP83825_PhaseCount]; /*!< Minimum phase time. */
+    uint32_t avgUs[kPHY_DP83825_PhaseCount]; /*!< Average phase time. */
+    uint32_t maxUs[kPHY_DP83825_PhaseCount]; /*!< Maximum phase time. */
+} phy_dp83825_phase_stats_t;
+
+/*! @brief Bring-up timing state. */
+typedef struct _phy_dp83825_link_timing
+{
+    phy_dp83825_timeline_t timeline;           /*!< Running or last bring-up. */
+    phy_dp83825_phase_stats_t stats;           /*!< Aggregate, avgUs unused. */
+    uint64_t totalUs[kPHY_DP83825_PhaseCount]; /*!< Sum of the phase times. */
+} phy_dp83825_link_timing_t;
+
+/*! @brief Energy Efficient Ethernet status. */
+typedef struct _phy_dp83825_eee_status
+{
+    bool advertised;      /*!< EEE advertised for 100BASE-TX. */
+    bool partner;         /*!< Link partner advertises EEE for 100BASE-TX. */
+    bool active;          /*!< EEE resolved on a 100BASE-TX full duplex link. */
+    bool rxLpi;           /*!< Receive path in low power idle. */
+    bool txLpi;           /*!< Transmit path in low power idle. */
+    bool rxLpiReceived;   /*!< Low power idle received since the last status read. */
+    bool txLpiReceived;   /*!< Low power idle transmitted since the last status read. */
+    uint16_t wakeErrors;  /*!< Wake errors since the last status read. */
+    uint16_t errorEvents; /*!< EEE error interrupts seen by the driver. */
+    uint16_t wakeTimeUs;  /*!< Worst case wake time of the link, 0 without EEE. */
+} phy_dp83825_eee_status_t;
+
+/*! @brief Built-in self test configuration. */
+typedef struct _phy_dp83825_bist_config
+{
+    phy_dp83825_loopback_t loopback; /*!< Where the PRBS returns, kPHY_DP83825_LoopbackNone for an external loop. */
+    phy_speed_t speed;               /*!< Test speed. */
+    uint16_t packetLength;           /*!< PRBS packet length in bytes, up to 2047. */
+    uint8_t ipg;                     /*!< Inter packet gap in byte times. */
+} phy_dp83825_bist_config_t;
+
+/*! @brief Built-in self test statistics. */
+typedef struct _phy_dp83825_bist_stats
+{
+    uint32_t elapsedUs;      /*!< Test duration. */
+    uint32_t packets;        /*!< Packets sent, derived from the line rate. */
+    uint32_t errors;         /*!< PRBS errors counted by the checker. */
+    uint32_t errorsPerGbit;  /*!< Errors per 10^9 bits sent. */
+    uint32_t throughputKbps; /*!< Packet data rate. */
+    bool locked;             /*!< The PRBS checker locked. */
+    bool syncLost;           /*!< The PRBS checker lost its lock during the test. */
+    bool saturated;          /*!< The error counter saturated between two reads, errors is a lower bound. */
+} phy_dp83825_bist_stats_t;
+
+/*! @brief Built-in self test state. */
+typedef struct _phy_dp83825_bist
+{
+    bool running;                     /*!< Packet generator running. */
+    phy_dp83825_bist_config_t config; /*!< Running test. */
+    uint32_t startUs;                 /*!< Test start. */
+    phy_dp83825_bist_stats_t stats;   /*!< Accumulated statistics. */
+} phy_dp83825_bist_t;
+
+/*! @brief Cable fault found by the cable diagnostic. */
+typedef enum _phy_dp83825_cable_fault
+{
+    kPHY_DP83825_CableNoFault = 0U, /*!< No reflection above the fault threshold. */
+    kPHY_DP83825_CableOpen,         /*!< Open pair, positive reflection. */
+    kPHY_DP83825_CableShort,        /*!< Shorted pair, negative reflection. */
+} phy_dp83825_cable_fault_t;
+
+/*! @brief Cable diagnostic result of one pair. */
+typedef struct _phy_dp83825_cable_pair
+{
+    phy_dp83825_cable_fault_t fault; /*!< Fault type. */
+    uint32_t faultCm;                /*!< Distance to the fault. */
+    uint32_t lengthCm;               /*!< Distance to the farthest reflection, 0 when none was seen. */
+} phy_dp83825_cable_pair_t;
+
+/*! @brief Cable diagnostic result. */
+typedef struct _phy_dp83825_cable_diag
+{
+    phy_dp83825_cable_pair_t pair[2]; /*!< TX and RX pair. */
+    uint32_t lengthCm;                /*!< Cable length estimate, 0 when unknown. */
+    uint32_t runTimeUs;               /*!< Start to result. */
+    uint32_t steps;                   /*!< MDIO steps the diagnostic took. */
+} phy_dp83825_cable_diag_t;
+
+/*! @brief Result registers the cable diagnostic reads. */
+#define PHY_DP83825_CABLE_RESULT_REGS (11U)
+
+/*! @brief Cable diagnostic job state. */
+typedef struct _phy_dp83825_cable_job
+{
+    uint8_t state;                               /*!< Job state, internal. */
+    uint8_t index;                               /*!< Next result register. */
+    uint32_t startUs;                            /*!< Diagnostic start. */
+    uint16_t raw[PHY_DP83825_CABLE_RESULT_REGS]; /*!< Result registers read so far. */
+    phy_dp83825_cable_diag_t result;             /*!< Last result. */
+} phy_dp83825_cable_job_t;
+
+/*! @brief Events reported through the resource event callback. */
+typedef enum _phy_dp83825_event
+{
+    kPHY_DP83825_EventDuplexMismatch = 0U, /*!< Half duplex by parallel detection against a full duplex partner. */
+    kPHY_DP83825_EventLinkUp,              /*!< Link came up, see PHY_DP83825_ProcessInterrupt(). */
+    kPHY_DP83825_EventLinkDown,            /*!< Link went down, see PHY_DP83825_ProcessInterrupt(). */
+} phy_dp83825_event_t;
+
+/*! @brief Driver event callback, called from the API function that found the event. */
+typedef void (*phy_dp83825_event_callback_t)(phy_handle_t *handle, phy_dp83825_event_t event, void *userData);
+
+/*! @brief Reaction to a detected duplex mismatch. */
+typedef enum _phy_dp83825_duplex_policy
+{
+    kPHY_DP83825_DuplexPolicyReport = 0U, /*!< Only raise the event. */
+    kPHY_DP83825_DuplexPolicyForceFull,   /*!< Disable auto-negotiation and force full duplex at the detected speed. */
+} phy_dp83825_duplex_policy_t;
+
+/*! @brief Duplex mismatch monitor configuration. */
+typedef struct _phy_dp83825_duplex_config
+{
+    phy_dp83825_duplex_policy_t policy; /*!< Reaction to a mismatch. */
+    uint32_t collisionThreshold;        /*!< MAC late collisions per check, 0 to ignore. */
+    uint32_t errorThreshold;            /*!< False carriers and receive errors per check, 0 to ignore. */
+} phy_dp83825_duplex_config_t;
+
+/*! @brief Duplex mismatch monitor state. */
+typedef struct _phy_dp83825_duplex_monitor
+{
+    phy_dp83825_duplex_config_t config; /*!< Monitor configuration. */
+    bool parallelDetect;                /*!< The link came up by parallel detection. */
+    bool mismatch;                      /*!< Mismatch detected on the current link. */
+    uint32_t checks;                    /*!< Checks run, the first one only samples the collision count. */
+    uint32_t lastCollisions;            /*!< MAC collision count at the last check. */
+    uint32_t collisions;                /*!< MAC late collisions since the last check. */
+    uint32_t falseCarriers;             /*!< False carrier events since the last check. */
+    uint32_t rxErrors;                  /*!< Receive errors since the last check. */
+    uint32_t lastFalseCarriers;         /*!< False carrier total at the last check. */
+    uint32_t lastRxErrors;              /*!< Receive error total at the last check. */
+    uint32_t events;                    /*!< Mismatches detected. */
+} phy_dp83825_duplex_monitor_t;
+
+/*!
+ * @brief DP83826 transmit amplitude.
+ *
+ * MLT-3 +1 and -1 DAC levels in basis points of the nominal amplitude, in steps of 625.
+ */
+typedef struct _phy_dp83825_vod
+{
+    uint16_t minusMdiBp;  /*!< -1 level in MDI mode. */
+    uint16_t minusMdixBp; /*!< -1 level in MDI-X mode. */
+    uint16_t plusMdiBp;   /*!< +1 level in MDI mode. */
+    uint16_t plusMdixBp;  /*!< +1 level in MDI-X mode. */
+} phy_dp83825_vod_t;
+
+/*! @brief Automatic transmit amplitude configuration. */
+typedef struct _phy_dp83825_vod_auto_config
+{
+    uint16_t minBp;          /*!< Lowest amplitude the automatic mode goes down to. */
+    uint16_t shortCableBp;   /*!< Starting amplitude on a short cable. */
+    uint32_t shortCableCm;   /*!< Longest cable taken as short, as estimated by the cable diagnostic if built in. */
+    uint32_t errorThreshold; /*!< False carriers and receive errors per update raising the amplitude a step. */
+    uint32_t stableUpdates;  /*!< Error free updates before lowering the amplitude a step. */
+} phy_dp83825_vod_auto_config_t;
+
+/*! @brief Transmit amplitude state. */
+typedef struct _phy_dp83825_vod_state
+{
+    bool valid;                               /*!< The setting is applied and restored after resets. */
+    phy_dp83825_vod_t setting;                /*!< Applied amplitude. */
+    bool autoEnabled;                         /*!< Automatic mode running. */
+    phy_dp83825_vod_auto_config_t autoConfig; /*!< Automatic mode configuration. */
+    uint16_t levelBp;                         /*!< Automatic mode amplitude, all four levels. */
+    uint16_t floorBp;                         /*!< Automatic mode does not go below, raised on errors. */
+    uint32_t cleanUpdates;                    /*!< Error free updates at the current level. */
+    uint32_t lastErrors;                      /*!< Error total at the last update. */
+} phy_dp83825_vod_state_t;
+
+/*! @brief DP83822 100BASE-FX fiber mode selection. */
+typedef enum _phy_dp83825_fiber_mode
+{
+    kPHY_DP83825_FiberStrap = 0U, /*!< Fiber or copper as strapped. */
+    kPHY_DP83825_FiberOff,        /*!< Copper. */
+    kPHY_DP83825_FiberOn,         /*!< 100BASE-FX fiber. */
+} phy_dp83825_fiber_mode_t;
+
+/*! @brief Polarity of the DP83822 fiber signal detect input. */
+typedef enum _phy_dp83825_sig_det
+{
+    kPHY_DP83825_SigDetStrap = 0U, /*!< Leave the polarity as strapped. */
+    kPHY_DP83825_SigDetHigh,       /*!< Optical signal present while the input is high. */
+    kPHY_DP83825_SigDetLow,        /*!< Optical signal present while the input is low. */
+} phy_dp83825_sig_det_t;
+
+/*!
+ * @brief Link flap damping configuration.
+ *
+ * Every link down adds penalty, the penalty halves every halfLifeUs. Above suppressThreshold the
+ * link is held down until the penalty decayed to reuseThreshold, at most maxSuppressUs.
+ */
+typedef struct _phy_dp83825_flap_config
+{
+    uint32_t holdDownUs;        /*!< Link downs shorter than this are not reported, longer ones this late. */
+    uint32_t holdUpUs;          /*!< Time the link has to stay up before it is reported up. */
+    uint32_t penalty;           /*!< Penalty of one link down. */
+    uint32_t suppressThreshold; /*!< Penalty at which the link is held down. */
+    uint32_t reuseThreshold;    /*!< Penalty at which a held down link is released. */
+    uint32_t halfLifeUs;        /*!< Penalty half-life, at least 8 us. */
+    uint32_t maxSuppressUs;     /*!< Longest time the link is held down. */
+    uint32_t intervalUs;        /*!< Flap counting interval. */
+} phy_dp83825_flap_config_t;
+
+/*! @brief Link flap damping statistics. */
+typedef struct _phy_dp83825_flap_stats
+{
+    uint32_t flaps;             /*!< Link downs seen. */
+    uint32_t filteredDowns;     /*!< Link downs shorter than the hold-down, not reported. */
+    uint32_t suppressions;      /*!< Times the link was held down for flapping. */
+    uint32_t intervalFlaps;     /*!< Link downs in the running interval. */
+    uint32_t lastIntervalFlaps; /*!< Link downs in the last complete interval. */
+    uint32_t maxIntervalFlaps;  /*!< Most link downs in one interval. */
+    uint32_t penalty;           /*!< Penalty as of the last link change or timer run. */
+    bool suppressed;            /*!< The link is held down. */
+} phy_dp83825_flap_stats_t;
+
+/*! @brief Link flap damping state. */
+typedef struct _phy_dp83825_flap
+{
+    bool enabled;                     /*!< Damping enabled. */
+    phy_dp83825_flap_config_t config; /*!< Damping configuration. */
+    bool rawUp;                       /*!< Link state read from the PHY. */
+    uint32_t changeUs;                /*!< Time of the last link change read from the PHY. */
+    uint32_t decayUs;                 /*!< The penalty is decayed up to this time. */
+    uint32_t suppressUs;              /*!< Start of the hold down. */
+    uint32_t intervalUs;              /*!< Start of the running flap counting interval. */
+    uint32_t ceiling;                 /*!< Highest penalty, decays to reuseThreshold in maxSuppressUs. */
+    phy_dp83825_flap_stats_t stats;   /*!< Statistics. */
+} phy_dp83825_flap_t;
+
+/*! @brief Number of consecutive Wake on Lan address and password registers, WOL_DA1 to RXSOP3. */
+#define PHY_DP83825_CHECKPOINT_WOL_REGS (6U)
+
+/*! @brief Register state captured by PHY_DP83825_Checkpoint(). */
+typedef struct _phy_dp83825_checkpoint
+{
+    uint16_t basic[PHY_DP83825_SHADOW_COUNT];      /*!< Shadowed configuration registers, volatile bits cleared. */
+    uint16_t edcr;                                 /*!< Energy detect control. */
+    uint16_t wolCfg;                               /*!< Wake on Lan configuration. */
+    uint16_t wol[PHY_DP83825_CHECKPOINT_WOL_REGS]; /*!< Wake on Lan address and SecureOn password. */
+    uint16_t eeeAdv;                               /*!< EEE advertisement. */
+    uint16_t vod[2];                               /*!< DP83826 VOD_CFG1 and VOD_CFG2. */
+    bool poweredDown;                              /*!< The PHY was powered down after the capture. */
+} phy_dp83825_checkpoint_t;
+
+/*! @brief Outcome of PHY_DP83825_Restore(). */
+typedef struct _phy_dp83825_restore
+{
+    bool lost;       /*!< The PHY had lost its registers or may have, all were written back. */
+    uint32_t frames; /*!< MDIO frames used. */
+    uint32_t timeUs; /*!< Restore time, 0 without a time source. */
+} phy_dp83825_restore_t;
+
+/*! @brief Energy detect power-down statistics. */
+typedef struct _phy_dp83825_energy_stats
+{
+    uint32_t powerDowns;         /*!< Times the front end was seen powered down. */
+    uint32_t wakeups;            /*!< Times energy was detected on the wire. */
+    uint32_t residencyUs;        /*!< Total time powered down. */
+    uint32_t lastResidencyUs;    /*!< Duration of the last power-down. */
+    uint32_t lastInsertToLinkUs; /*!< Energy detected to link up, last time. */
+    uint32_t maxInsertToLinkUs;  /*!< Energy detected to link up, worst case. */
+} phy_dp83825_energy_stats_t;
+
+/*! @brief Energy detect power-down state. */
+typedef struct _phy_dp83825_energy_detect
+{
+    bool enabled;                     /*!< Energy detect power-down enabled. */
+    bool poweredDown;                 /*!< Front end powered down, link polling stopped. */
+    bool waking;                      /*!< Energy detected, waiting for the link. */
+    uint16_t idlePolls;               /*!< Link polls between bus checks while powered down, 0 for interrupt only. */
+    uint16_t pollCount;               /*!< Link polls since the last bus check. */
+    uint32_t downStartUs;             /*!< Power-down start. */
+    uint32_t wakeUs;                  /*!< Energy detection time. */
+    phy_dp83825_energy_stats_t stats; /*!< Statistics. */
+} phy_dp83825_energy_detect_t;
+
 typedef struct _phy_dp83825_resource_t
 {
     mdioWrite write;
     mdioRead read;
     mdioWriteExt writeExt;
     mdioReadExt readExt;
+    phyGetTimeUs getTimeUs;                     /*!< Optional time source, NULL if not available. */
+    phyDelayUs delayUs;                         /*!< Optional delay, NULL to use SDK_DelayAtLeastUs(). */
+    phy_dp83825_event_callback_t eventCallback; /*!< Optional event notification, NULL if not used. */
+    void *eventUserData;                        /*!< Passed to eventCallback. */
+    phy_dp83825_fiber_mode_t fiberMode;         /*!< DP83822 fiber mode, zero follows the straps. */
+    phy_dp83825_sig_det_t fiberSigDet;          /*!< DP83822 signal detect polarity, zero follows the straps. */
+    const phy_dp83825_bus_t *bus;               /*!< Optional bus, used instead of read/write when not NULL. */
+
+    /* Driver state, maintained by the driver. */
+    phy_dp83825_retry_policy_t retryPolicy; /*!< MDIO retry policy. */
+    phy_dp83825_retry_stats_t retryStats;   /*!< MDIO retry statistics. */
+    uint32_t callStartUs;                   /*!< Start time of the running API call. */
+    uint8_t callDepth;                      /*!< Nesting of API functions called from within the driver. */
+    phy_dp83825_shadow_t shadow;            /*!< Configuration register shadow. */
+    uint32_t phyId;                         /*!< PHY ID detected by PHY_DP83825_Init(). */
+    phy_dp83825_variant_t variant;          /*!< PHY variant detected by PHY_DP83825_Init(). */
+    bool fiber;                             /*!< DP83822 configured for 100BASE-FX. */
+    uint16_t rcsr;                          /*!< RCSR value applied by PHY_DP83825_Init(). */
+    phy_config_t config;                    /*!< Last configuration applied by PHY_DP83825_Init(). */
+    phy_dp83825_watchdog_t watchdog;        /*!< Hang detection and recovery state. */
+#if PHY_DP83825_ENABLE_TELEMETRY
+    phy_dp83825_link_timing_t timing;       /*!< Link bring-up timing. */
+#endif
+    uint16_t eeeErrorEvents;                /*!< EEE error interrupts seen. */
+    uint16_t misr1Latched;                  /*!< MISR1 status bits read but not yet consumed. */
+    uint16_t misr2Latched;                  /*!< MISR2 status bits read but not yet consumed. */
+    phy_dp83825_energy_detect_t energy;     /*!< Energy detect power-down state. */
+#if PHY_DP83825_ENABLE_LOOPBACK
+    bool loopbackActive;                    /*!< Loopback set by PHY_DP83825_SetLoopback(). */
+    phy_dp83825_config_t loopbackSaved;     /*!< Configuration to restore when leaving loopback. */
+#endif
+#if PHY_DP83825_ENABLE_DIAGNOSTICS
+    phy_dp83825_bist_t bist;                /*!< Built-in self test state. */
+    phy_dp83825_cable_job_t cable;          /*!< Cable diagnostic job. */
+    phy_dp83825_duplex_monitor_t duplex;    /*!< Duplex mismatch monitor. */
+#endif
+    uint32_t falseCarriers;                 /*!< False carrier events read from FCSCR, free running. */
+    uint32_t rxErrors;                      /*!< Receive errors read from RECR, free running. */
+    bool linkUp;                            /*!< Link state last reported by PHY_DP83825_ProcessInterrupt(). */
+#if (PHY_DP83825_ENABLE_DP83826 && PHY_DP83825_ENABLE_EXT)
+    phy_dp83825_vod_state_t vod;            /*!< DP83826 transmit amplitude. */
+#endif
+    phy_dp83825_flap_t flap;                /*!< Link flap damping. */
 } phy_dp83825_resource_t;
 
-/*! @brief PHY operations structure. */
+/*! @brief Defines the register script operations. */
+typedef enum _phy_dp83825_script_op
+{
+    kPHY_DP83825_ScriptWrite = 0U, /*!< Write value to the register. */
+    kPHY_DP83825_ScriptModify,     /*!< Replace the mask bits of the register by the value bits. */
+    kPHY_DP83825_ScriptWait,       /*!< Wait until the mask bits of the register equal the value bits. */
+    kPHY_DP83825_ScriptIfPhyId,    /*!< Skip the next arg entries unless the PHY ID2 mask bits equal the value. */
+} phy_dp83825_script_op_t;
+
+/*! @brief Flag of the script operation, the register is an extended register. */
+#define PHY_DP83825_SCRIPT_EXT (0x80U)
+
+/*! @brief Defines a register script entry.
+ *
+ * Scripts are constant tables run by PHY_DP83825_RunScript(). Consecutive write and modify
+ * entries on the same register are merged into a single MDIO write.
+ */
+typedef struct _phy_dp83825_script
+{
+    uint8_t op;     /*!< Operation, see phy_dp83825_script_op_t, optionally ORed with PHY_DP83825_SCRIPT_EXT. */
+    uint8_t arg;    /*!< Wait timeout in ms, or number of entries skipped by kPHY_DP83825_ScriptIfPhyId. */
+    uint16_t reg;   /*!< Register address. */
+    uint16_t mask;  /*!< Register bits affected by the operation. */
+    uint16_t value; /*!< Register bits value. */
+} phy_dp83825_script_t;
+
+/*! @brief Register scripts the driver runs, see PHY_DP83825_GetScript(). */
+typedef enum _phy_dp83825_script_id
+{
+    kPHY_DP83825_ScriptIdReset = 0U,      /*!< Reset and wait for the PHY to answer again. */
+    kPHY_DP83825_ScriptIdVariantInit,     /*!< Variant specific initialization. */
+    kPHY_DP83825_ScriptIdInit,            /*!< Common initialization. */
+    kPHY_DP83825_ScriptIdAutoNeg,         /*!< Advertise all abilities and start auto-negotiation. */
+    kPHY_DP83825_ScriptIdLinkIntrEnable,  /*!< Enable the link status interrupt. */
+    kPHY_DP83825_ScriptIdLinkIntrDisable, /*!< Disable the link status interrupt. */
+} phy_dp83825_script_id_t;
+
+/*! @brief Defines the register script entries. */
+#define PHY_DP83825_SCRIPT_WRITE(reg, value) {kPHY_DP83825_ScriptWrite, 0U, (reg), 0xFFFFU, (value)}
+#define PHY_DP83825_SCRIPT_MODIFY(reg, mask, value) {kPHY_DP83825_ScriptModify, 0U, (reg), (mask), (value)}
+#define PHY_DP83825_SCRIPT_SET(reg, bits) PHY_DP83825_SCRIPT_MODIFY(reg, bits, bits)
+#define PHY_DP83825_SCRIPT_CLEAR(reg, bits) PHY_DP83825_SCRIPT_MODIFY(reg, bits, 0U)
+#define PHY_DP83825_SCRIPT_WAIT(reg, mask, value, timeoutMs) \
+    {kPHY_DP83825_ScriptWait, (timeoutMs), (reg), (mask), (value)}
+#define PHY_DP83825_SCRIPT_IF_PHYID(mask, id2, count) {kPHY_DP83825_ScriptIfPhyId, (count), 0U, (mask), (id2)}
+#define PHY_DP83825_SCRIPT_EXT_WRITE(reg, value) \
+    {kPHY_DP83825_ScriptWrite | PHY_DP83825_SCRIPT_EXT, 0U, (reg), 0xFFFFU, (value)}
+#define PHY_DP83825_SCRIPT_EXT_MODIFY(reg, mask, value) \
+    {kPHY_DP83825_ScriptModify | PHY_DP83825_SCRIPT_EXT, 0U, (reg), (mask), (value)}
+#define PHY_DP83825_SCRIPT_EXT_SET(reg, bits) PHY_DP83825_SCRIPT_EXT_MODIFY(reg, bits, bits)
+#define PHY_DP83825_SCRIPT_EXT_CLEAR(reg, bits) PHY_DP83825_SCRIPT_EXT_MODIFY(reg, bits, 0U)
+
+/*! @brief Entries of the script returned by PHY_DP83825_GetLoopbackScript(). */
+#define PHY_DP83825_LOOPBACK_SCRIPT_COUNT (2U)
+
+/*! @brief What a script run needs next, see PHY_DP83825_ScriptStep(). */
+typedef enum _phy_dp83825_script_action
+{
+    kPHY_DP83825_ScriptActionRead = 0U, /*!< Read reg of devAddr. */
+    kPHY_DP83825_ScriptActionWrite,     /*!< Write value to reg of devAddr. */
+    kPHY_DP83825_ScriptActionDelay,     /*!< Wait delayUs. */
+    kPHY_DP83825_ScriptActionDone,      /*!< Script finished with status. */
+} phy_dp83825_script_action_t;
+
+/*!
+ * @brief State of a script run one MDIO frame at a time.
+ *
+ * The engine behind PHY_DP83825_RunScript(), for drivers doing their own MDIO accesses, e.g.
+ * an asynchronous one. Only action and the frame members are meant to be read.
+ */
+typedef struct _phy_dp83825_script_run
+{
+    phy_dp83825_script_action_t action; /*!< Next action. */
+    uint8_t devAddr;                    /*!< MMD of the frame, 0 for a basic register. */
+    uint16_t reg;                       /*!< Register of the frame. */
+    uint16_t value;                     /*!< Value to write. */
+    uint32_t delayUs;                   /*!< Delay to wait. */
+    status_t status;                    /*!< Result once done. */
+    const phy_dp83825_script_t *script; /*!< Script entries. */
+    uint32_t count;                     /*!< Number of script entries. */
+    uint32_t index;                     /*!< Entry after the running one. */
+    uint32_t phyId;                     /*!< PHY ID the kPHY_DP83825_ScriptIfPhyId entries test. */
+    uint32_t polls;                     /*!< Polls left of the running wait entry. */
+    uint16_t mask;                      /*!< Bits defined by the running entries. */
+    uint16_t expect;                    /*!< Value of the mask bits, written or waited for. */
+    bool wait;                          /*!< The running entry is a wait. */
+    bool written;                       /*!< The running entries contain a write. */
+} phy_dp83825_script_run_t;
+
+/*! @brief PHY operations structure.
+ *
+ * Generic entry point for all variants, PHY_DP83825_Init() detects the PHY and rebinds the
+ * handle to the operations of the detected variant.
+ */
 extern const phy_operations_t phydp83825_ops;
 
 /*******************************************************************************
@@ -42,7 +704,8 @@ extern "C" {
 
 /*!
  * @brief Initializes PHY.
- * This function initializes PHY.
+ * This function initializes PHY, detects its variant and binds the handle to the
+ * operations of that variant.
  *
  * @param handle       PHY device handle.
  * @param config       Pointer to structure of phy_config_t.
@@ -52,6 +715,26 @@ extern "C" {
  */
 status_t PHY_DP83825_Init(phy_handle_t *handle, const phy_config_t *config);
 
+/*!
+ * @brief Gets the PHY variant detected by PHY_DP83825_Init().
+ *
+ * @param handle  PHY device handle.
+ * @return The PHY variant, kPHY_DP83825_VariantUnknown before initialization.
+ */
+phy_dp83825_variant_t PHY_DP83825_GetVariant(phy_handle_t *handle);
+
+/*!
+ * @brief Gets whether the PHY was initialized for 100BASE-FX fiber.
+ *
+ * Only the DP83822 supports fiber. The mode comes from the fiberMode resource member, by default
+ * from the straps. In fiber mode the link is forced to 100M full duplex without auto-negotiation
+ * and goes down as soon as the signal detect input drops, the link interrupt reports it.
+ *
+ * @param handle  PHY device handle.
+ * @return true in fiber mode.
+ */
+bool PHY_DP83825_IsFiber(phy_handle_t *handle);
+
 /*!
  * @brief PHY Write function.
  * This function writes data over the MDIO to the specified PHY register.
@@ -114,6 +797,20 @@ status_t PHY_DP83825_GetLinkStatus(phy_handle_t *handle, bool *status);
  */
 status_t PHY_DP83825_GetLinkSpeedDuplex(phy_handle_t *handle, phy_speed_t *speed, phy_duplex_t *duplex);
 
+/*!
+ * @brief Gets the flow control resolved by auto-negotiation.
+ *
+ * Resolves the local and link partner pause abilities as IEEE 802.3 annex 28B does. Pause only
+ * applies to a full duplex link.
+ *
+ * @param handle   PHY device handle.
+ * @param rxPause  Whether the MAC should act on received pause frames.
+ * @param txPause  Whether the MAC may send pause frames.
+ * @retval kStatus_Success  Flow control resolved.
+ * @retval kStatus_Timeout  PHY MDIO visit time out
+ */
+status_t PHY_DP83825_GetLinkPause(phy_handle_t *handle, bool *rxPause, bool *txPause);
+
 /*!
  * @brief Sets the PHY link speed and duplex.
  *
@@ -128,6 +825,8 @@ status_t PHY_DP83825_SetLinkSpeedDuplex(phy_handle_t *handle, phy_speed_t speed,
 /*!
  * @brief Enables/Disables PHY loopback.
  *
+ * Disabling restores the configuration from before the loopback, see PHY_DP83825_SetLoopback().
+ *
  * @param handle   PHY device handle.
  * @param mode     The loopback mode to be enabled, please see "phy_loop_t".
  * All loopback modes should not be set together, when one loopback mode is set
@@ -136,9 +835,28 @@ status_t PHY_DP83825_SetLinkSpeedDuplex(phy_handle_t *handle, phy_speed_t speed,
  * @param enable   True to enable, false to disable.
  * @retval kStatus_Success  PHY loopback success
  * @retval kStatus_Timeout  PHY MDIO visit time out
+ * @retval kStatus_InvalidArgument  Loopback left out of the build, see PHY_DP83825_ENABLE_LOOPBACK.
  */
 status_t PHY_DP83825_EnableLoopback(phy_handle_t *handle, phy_loop_t mode, phy_speed_t speed, bool enable);
 
+#if PHY_DP83825_ENABLE_LOOPBACK
+/*!
+ * @brief Selects a loopback point.
+ *
+ * Loopback runs full duplex with auto-negotiation off. PCS and reverse loopback run at 100M,
+ * the other points at the given speed. The configuration from before the first loopback is
+ * kept, kPHY_DP83825_LoopbackNone restores it and only writes the registers that differ, so a
+ * forced link comes back without renegotiation.
+ *
+ * @param handle    PHY device handle.
+ * @param loopback  Loopback point, kPHY_DP83825_LoopbackNone to leave loopback.
+ * @param speed     Speed of the local, digital and analog loopback.
+ * @retval kStatus_Success  Loopback selected.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_SetLoopback(phy_handle_t *handle, phy_dp83825_loopback_t loopback, phy_speed_t speed);
+#endif
+
 /*!
  * @brief Enables/Disables PHY AutoMDI/X.
  *
@@ -148,23 +866,573 @@ status_t PHY_DP83825_EnableLoopback(phy_handle_t *handle, phy_loop_t mode, phy_s
  * @param type    PHY interrupt type.
  * @param enable  True to enable, false to disable.
  * @retval kStatus_Success  PHY AutoMDI/X successfully set
- * @retval kStatus_InvalidArgument PHY AutoMDI/X disable implementation pending.
+ * @retval kStatus_Timeout  PHY MDIO visit time out
  */
 status_t PHY_DP83825_EnableAutoMDIX(phy_handle_t *handle, phy_interrupt_type_t type, bool enable);
 
+#if PHY_DP83825_ENABLE_WOL
 /*!
  * @brief Enables/Disables Wake on Lan.
  *
- * This function controls the Wake on Lan setting.
+ * This function controls the Wake on Lan setting. Enabling wakes on magic packets to the
+ * address and password set by PHY_DP83825_ConfigureWakeOnLan(), the wake indication is
+ * cleared.
  *
  * @param handle  PHY device handle.
  * @param type    PHY interrupt type.
  * @param enable  True to enable, false to disable.
- * @retval kStatus_Success  Wake on Lan successfully disabled
- * @retval kStatus_InvalidArgument Wake On Lan enable implementation pending.
+ * @retval kStatus_Success  Wake on Lan successfully enabled or disabled.
+ * @retval kStatus_Timeout  PHY access timeout.
  */
 status_t PHY_DP83825_EnableWakeOnLan(phy_handle_t *handle, phy_interrupt_type_t type, bool enable);
 
+/*!
+ * @brief Configures and enables Wake on Lan.
+ *
+ * Wake packets are signaled by the MISR2 WoL packet interrupt when it is enabled.
+ *
+ * @param handle  PHY device handle.
+ * @param config  Wake on Lan configuration, Wake on Lan is disabled if neither magic nor secureOn is set.
+ * @retval kStatus_Success  Wake on Lan configured.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_ConfigureWakeOnLan(phy_handle_t *handle, const phy_dp83825_wol_config_t *config);
+
+/*!
+ * @brief Gets and clears the wake indication.
+ *
+ * @param handle  PHY device handle.
+ * @param woken   True if a wake packet was received since the last call.
+ * @retval kStatus_Success  Indication read.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_GetWakeStatus(phy_handle_t *handle, bool *woken);
+
+/*!
+ * @brief Prepares the PHY for system sleep.
+ *
+ * Saves the current configuration, enables Wake on Lan and its interrupt. The link stays up.
+ *
+ * @param handle  PHY device handle.
+ * @param wol     Wake on Lan configuration, NULL to keep the one already set.
+ * @param saved   The configuration to pass to PHY_DP83825_Resume().
+ * @retval kStatus_Success  PHY ready for sleep.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_Suspend(phy_handle_t *handle, const phy_dp83825_wol_config_t *wol, phy_dp83825_config_t *saved);
+
+/*!
+ * @brief Restores the configuration saved by PHY_DP83825_Suspend().
+ *
+ * Disables Wake on Lan and writes back only the registers that differ from the saved
+ * configuration, so a link kept during sleep is not renegotiated. The registers are read
+ * again in case the PHY lost power.
+ *
+ * @param handle  PHY device handle.
+ * @param saved   Configuration saved by PHY_DP83825_Suspend().
+ * @param woken   Optional, true if the PHY saw a wake packet.
+ * @retval kStatus_Success  Configuration restored.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_Resume(phy_handle_t *handle, const phy_dp83825_config_t *saved, bool *woken);
+#endif
+
+#if PHY_DP83825_ENABLE_EXT
+/*!
+ * @brief Captures the PHY configuration for a power-down cycle.
+ *
+ * Reads every configured register in one pass, registers known from the shadow are not read
+ * and the extended registers are read in MMD bursts. With powerDown the PHY is then powered
+ * down through BMCR, which also takes the link down.
+ *
+ * @param handle      PHY device handle.
+ * @param checkpoint  The captured state.
+ * @param powerDown   Power the PHY down after the capture.
+ * @retval kStatus_Success  State captured.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_Checkpoint(phy_handle_t *handle, phy_dp83825_checkpoint_t *checkpoint, bool powerDown);
+
+/*!
+ * @brief Restores the state captured by PHY_DP83825_Checkpoint(), without the reinitialization.
+ *
+ * BMCR and one register captured away from its reset value tell whether the PHY kept its
+ * registers: both still as captured, and powered down if it was, then only BMCR is written to power
+ * the PHY up. Otherwise, or when every captured register is at its reset value, all registers
+ * are written back, MAC
+ * interface first and BMCR last, extended registers in MMD bursts. Auto-negotiation is restarted
+ * if enabled.
+ *
+ * @param handle      PHY device handle.
+ * @param checkpoint  State captured by PHY_DP83825_Checkpoint().
+ * @param restore     Optional, what the restore did and how long it took.
+ * @retval kStatus_Success  State restored.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_Restore(phy_handle_t *handle,
+                             const phy_dp83825_checkpoint_t *checkpoint,
+                             phy_dp83825_restore_t *restore);
+#endif
+
+/*!
+ * @brief Applies a full PHY configuration.
+ *
+ * The configuration is compared with the current register state, which is taken from the
+ * driver's register shadow where known, and only the registers that differ are written.
+ * Registers are written in a safe order: MAC interface, interrupts, MDI/MDI-X, advertisement,
+ * loopback and control. Auto-negotiation is only restarted when it gets enabled or the
+ * advertised abilities change.
+ *
+ * @param handle  PHY device handle.
+ * @param config  Desired PHY configuration.
+ * @retval kStatus_Success  PHY configuration applied
+ * @retval kStatus_Timeout  PHY MDIO visit time out
+ */
+status_t PHY_DP83825_ApplyConfig(phy_handle_t *handle, const phy_dp83825_config_t *config);
+
+/*!
+ * @brief Gets the current PHY configuration.
+ *
+ * Decodes the configuration registers, registers known from the shadow are not read.
+ *
+ * @param handle  PHY device handle.
+ * @param config  The current PHY configuration.
+ * @retval kStatus_Success  PHY configuration read
+ * @retval kStatus_Timeout  PHY MDIO visit time out
+ */
+status_t PHY_DP83825_GetConfig(phy_handle_t *handle, phy_dp83825_config_t *config);
+
+/*!
+ * @brief Runs a register script.
+ *
+ * Consecutive write/modify entries on the same register are merged into one MDIO write, the
+ * register is only read when the merged entries do not cover all of its bits, and a merged
+ * modify that does not change the register is not written.
+ *
+ * @param handle  PHY device handle.
+ * @param script  Script entries.
+ * @param count   Number of script entries.
+ * @retval kStatus_Success  Script completed
+ * @retval kStatus_Timeout  PHY MDIO visit time out or a wait entry timed out
+ */
+status_t PHY_DP83825_RunScript(phy_handle_t *handle, const phy_dp83825_script_t *script, uint32_t count);
+
+/*!
+ * @brief Gets a register script the driver runs.
+ *
+ * Lets other drivers of the PHY, e.g. an asynchronous one, run the same sequences.
+ *
+ * @param id     Script.
+ * @param phyId  PHY ID, selects the kPHY_DP83825_ScriptIdVariantInit script.
+ * @param count  Number of script entries.
+ * @return The script entries, NULL when the variant is not supported by this build.
+ */
+const phy_dp83825_script_t *PHY_DP83825_GetScript(phy_dp83825_script_id_t id, uint32_t phyId, uint32_t *count);
+
+/*!
+ * @brief Gets the register script selecting a loopback point.
+ *
+ * Sets BISCR and BMCR like PHY_DP83825_SetLoopback(), full duplex and, for the points on the
+ * 100BASE-TX path, 100M. kPHY_DP83825_LoopbackNone only clears the loopback, the forced speed and
+ * duplex stay.
+ *
+ * @param loopback  Loopback point.
+ * @param speed     Speed of the loopback.
+ * @param script    At least PHY_DP83825_LOOPBACK_SCRIPT_COUNT entries, filled in.
+ * @return Number of script entries.
+ */
+uint32_t PHY_DP83825_GetLoopbackScript(phy_dp83825_loopback_t loopback,
+                                       phy_speed_t speed,
+                                       phy_dp83825_script_t *script);
+
+/*!
+ * @brief Starts running a script one MDIO frame at a time.
+ *
+ * Same semantics as PHY_DP83825_RunScript(). Perform run->action, pass its result to
+ * PHY_DP83825_ScriptStep() and repeat until the action is kPHY_DP83825_ScriptActionDone.
+ *
+ * @param run     Run state.
+ * @param script  Script entries, must stay valid while running.
+ * @param count   Number of script entries.
+ * @param phyId   PHY ID, for the kPHY_DP83825_ScriptIfPhyId entries.
+ */
+void PHY_DP83825_ScriptStart(phy_dp83825_script_run_t *run,
+                             const phy_dp83825_script_t *script,
+                             uint32_t count,
+                             uint32_t phyId);
+
+/*!
+ * @brief Advances a script run by the result of its last action.
+ *
+ * @param run     Run state.
+ * @param status  Status of the frame, kStatus_Success after a delay.
+ * @param data    Value read by a read action.
+ * @return The next action, also in run->action.
+ */
+phy_dp83825_script_action_t PHY_DP83825_ScriptStep(phy_dp83825_script_run_t *run, status_t status, uint16_t data);
+
+/*!
+ * @brief Sets the MDIO retry and timeout policy.
+ *
+ * The retry statistics are cleared.
+ *
+ * @param handle  PHY device handle.
+ * @param policy  Retry policy.
+ */
+void PHY_DP83825_SetRetryPolicy(phy_handle_t *handle, const phy_dp83825_retry_policy_t *policy);
+
+/*!
+ * @brief Gets the MDIO retry statistics.
+ *
+ * @param handle  PHY device handle.
+ * @param stats   The retry statistics.
+ */
+void PHY_DP83825_GetRetryStats(phy_handle_t *handle, phy_dp83825_retry_stats_t *stats);
+
+/*!
+ * @brief Configures the hang detection watchdog.
+ *
+ * The watchdog state and statistics are cleared.
+ *
+ * @param handle  PHY device handle.
+ * @param config  Watchdog configuration.
+ */
+void PHY_DP83825_SetWatchdogConfig(phy_handle_t *handle, const phy_dp83825_watchdog_config_t *config);
+
+/*!
+ * @brief Gets the hang condition detected by the watchdog.
+ *
+ * @param handle  PHY device handle.
+ * @param hang    The current hang condition, kPHY_DP83825_HangNone if the PHY is healthy.
+ * @param stats   The recovery statistics, can be NULL.
+ */
+void PHY_DP83825_GetHangStatus(phy_handle_t *handle, phy_dp83825_hang_t *hang, phy_dp83825_recovery_stats_t *stats);
+
+/*!
+ * @brief Recovers a hung PHY.
+ *
+ * Issues a soft reset first and escalates to a hard reset if the PHY does not answer
+ * with its ID afterwards. The last configuration given to PHY_DP83825_Init() is then
+ * reapplied.
+ *
+ * @param handle  PHY device handle.
+ * @retval kStatus_Success  PHY recovered
+ * @retval kStatus_Fail  PHY does not answer after a hard reset
+ * @retval kStatus_Timeout  PHY MDIO visit time out
+ */
+status_t PHY_DP83825_Recover(phy_handle_t *handle);
+
+#if PHY_DP83825_ENABLE_EXT
+/*!
+ * @brief Enables/Disables Energy Efficient Ethernet.
+ *
+ * Changes the 100BASE-TX EEE advertisement and renegotiates if it changed. PHY_DP83825_Init()
+ * applies phy_config_t.enableEEE the same way.
+ *
+ * @param handle  PHY device handle.
+ * @param enable  True to advertise EEE, false to stop advertising it.
+ * @retval kStatus_Success  EEE configured.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_EnableEEE(phy_handle_t *handle, bool enable);
+
+/*!
+ * @brief Gets the Energy Efficient Ethernet status.
+ *
+ * The wake time tells the worst case latency added to the first frame after low power idle,
+ * use it to decide per port between power saving and wake latency.
+ *
+ * @param handle  PHY device handle.
+ * @param status  The EEE status.
+ * @retval kStatus_Success  Status read.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_GetEEEStatus(phy_handle_t *handle, phy_dp83825_eee_status_t *status);
+#endif
+
+#if PHY_DP83825_ENABLE_DIAGNOSTICS
+/*!
+ * @brief Starts the built-in self test.
+ *
+ * Selects the loopback point and lets the PHY send PRBS packets until PHY_DP83825_StopBist().
+ * The PRBS checker compares what comes back. Without internal loopback, the line needs a
+ * loopback plug or a link partner in reverse loopback.
+ *
+ * @param handle  PHY device handle.
+ * @param config  Test configuration.
+ * @retval kStatus_Success          Test running.
+ * @retval kStatus_InvalidArgument  Reverse loopback selected or packet length out of range.
+ * @retval kStatus_Timeout          PHY access timeout.
+ */
+status_t PHY_DP83825_StartBist(phy_handle_t *handle, const phy_dp83825_bist_config_t *config);
+
+/*!
+ * @brief Gets the built-in self test statistics so far.
+ *
+ * Reads and accumulates the error counter, call it often enough for the 8 bit counter not to
+ * saturate in between.
+ *
+ * @param handle  PHY device handle.
+ * @param stats   The test statistics.
+ * @retval kStatus_Success  Statistics read.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_GetBistStats(phy_handle_t *handle, phy_dp83825_bist_stats_t *stats);
+
+/*!
+ * @brief Stops the built-in self test and restores the configuration.
+ *
+ * @param handle  PHY device handle.
+ * @param stats   Optional, the final test statistics.
+ * @retval kStatus_Success  Test stopped.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_StopBist(phy_handle_t *handle, phy_dp83825_bist_stats_t *stats);
+
+/*!
+ * @brief Runs the built-in self test for a number of packets.
+ *
+ * Blocks for the time the packets take on the wire.
+ *
+ * @param handle   PHY device handle.
+ * @param config   Test configuration.
+ * @param packets  Packets to send.
+ * @param stats    The test statistics.
+ * @retval kStatus_Success          Test run, see the statistics for errors.
+ * @retval kStatus_InvalidArgument  Configuration not supported.
+ * @retval kStatus_Timeout          PHY access timeout.
+ */
+status_t PHY_DP83825_RunBist(phy_handle_t *handle,
+                             const phy_dp83825_bist_config_t *config,
+                             uint32_t packets,
+                             phy_dp83825_bist_stats_t *stats);
+
+/*!
+ * @brief Starts the cable diagnostic.
+ *
+ * Only issues the start, the diagnostic runs as a job advanced by PHY_DP83825_StepCableDiag().
+ * The link drops while the TDR pulses are sent.
+ *
+ * @param handle  PHY device handle.
+ * @retval kStatus_Success  Diagnostic started.
+ * @retval kStatus_Busy     A diagnostic is already running.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_StartCableDiag(phy_handle_t *handle);
+
+/*!
+ * @brief Advances the cable diagnostic by at most one MDIO access.
+ *
+ * Call it from the link management loop until it stops returning kStatus_Busy.
+ *
+ * @param handle  PHY device handle.
+ * @param result  The diagnostic result, filled on kStatus_Success.
+ * @retval kStatus_Success                Diagnostic complete.
+ * @retval kStatus_Busy                   Diagnostic running.
+ * @retval kStatus_NoTransferInProgress   No diagnostic started.
+ * @retval kStatus_Fail                   The PHY reported the diagnostic failed.
+ * @retval kStatus_Timeout                PHY access timeout or the diagnostic did not finish.
+ */
+status_t PHY_DP83825_StepCableDiag(phy_handle_t *handle, phy_dp83825_cable_diag_t *result);
+
+/*!
+ * @brief Decodes the cable diagnostic result registers.
+ *
+ * Used by PHY_DP83825_StepCableDiag(), for drivers reading the result registers themselves.
+ *
+ * @param raw     The PHY_DP83825_CABLE_RESULT_REGS registers from MII_DP83822_CDLRR1 on.
+ * @param result  The decoded result, runTimeUs and steps are left alone.
+ */
+void PHY_DP83825_DecodeCableDiag(const uint16_t *raw, phy_dp83825_cable_diag_t *result);
+
+/*!
+ * @brief Gets the cable length estimated by the last cable diagnostic.
+ *
+ * @param handle    PHY device handle.
+ * @param lengthCm  The cable length.
+ * @retval kStatus_Success  Length returned.
+ * @retval kStatus_NoData   No diagnostic estimated the length yet.
+ */
+status_t PHY_DP83825_GetCableLength(phy_handle_t *handle, uint32_t *lengthCm);
+
+/*!
+ * @brief Configures the duplex mismatch monitor.
+ *
+ * @param handle  PHY device handle.
+ * @param config  Monitor configuration.
+ * @retval kStatus_Success  Monitor configured.
+ */
+status_t PHY_DP83825_ConfigureDuplexMonitor(phy_handle_t *handle, const phy_dp83825_duplex_config_t *config);
+
+/*!
+ * @brief Checks the link for a duplex mismatch.
+ *
+ * A half duplex link brought up by parallel detection is a mismatch when the partner is forced to full
+ * duplex. The partner then sees CRC errors and the local MAC late collisions, the PHY false carriers and
+ * receive errors. Call it periodically, a mismatch raises kPHY_DP83825_EventDuplexMismatch once per link
+ * and applies the configured policy. Parallel detection is confirmed by the half duplex technology of the
+ * link in ANLPAR, and a mismatch needs at least one threshold crossed: with both thresholds 0 nothing is
+ * reported.
+ *
+ * @param handle         PHY device handle.
+ * @param macCollisions  Late collision count of the MAC, free running.
+ * @param mismatch       Whether the link has a duplex mismatch.
+ * @retval kStatus_Success  Link checked.
+ * @retval kStatus_Timeout  PHY access timeout.
+ */
+status_t PHY_DP83825_CheckDuplexMismatch(phy_handle_t *handle, uint32_t macCollisions, bool *mismatch);
+
+/*!
+ * @brief Gets the duplex mismatch monitor state.
+ *
+ * @param handle   PHY device handle.
+ * @param monitor  The monitor state of the last check.
+ * @retval kStatus_Success  State returned.
+ */
+status_t PHY_DP83825_GetDuplexMonitor(phy_handle_t *handle, phy_dp83825_duplex_monitor_t *monitor);
+#endif
+
+#if (PHY_DP83825_ENABLE_DP83826 && PHY_DP83825_ENABLE_EXT)
+/*!
+ * @brief Sets the DP83826 transmit amplitude.
+ *
+ * The amplitude is kept and applied again when the PHY is reinitialized.
+ *
+ * @param handle  PHY device handle.
+ * @param vod     Transmit amplitude, from 5000 to the largest level the register holds.
+ * @retval kStatus_Success          Amplitude set.
+ * @retval kStatus_InvalidArgument  Not a DP83826 or a level out of range.
+ * @retval kStatus_Timeout          PHY access timeout.
+ */
+status_t PHY_DP83825_SetVod(phy_handle_t *handle, const phy_dp83825_vod_t *vod);
+
+/*!
+ * @brief Gets the DP83826 transmit amplitude.
+ *
+ * @param handle  PHY device handle.
+ * @param vod     The transmit amplitude read from the PHY.
+ * @retval kStatus_Success          Amplitude read.
+ * @retval kStatus_InvalidArgument  Not a DP83826.
+ * @retval kStatus_Timeout          PHY access timeout.
+ */
+status_t PHY_DP83825_GetVod(phy_handle_t *handle, phy_dp83825_vod_t *vod);
+
+/*!
+ * @brief Enables/Disables the automatic DP83826 transmit amplitude.
+ *
+ * Starts from the short cable amplitude when the last cable diagnostic found a short cable, from the
+ * nominal amplitude otherwise. PHY_DP83825_UpdateAutoVod() then walks the amplitude down on an error
+ * free link, and back up when the error counters climb.
+ *
+ * @param handle  PHY device handle.
+ * @param config  Automatic mode configuration, NULL to stop at the current amplitude.
+ * @retval kStatus_Success          Automatic mode enabled or disabled.
+ * @retval kStatus_InvalidArgument  Not a DP83826 or a level out of range.
+ * @retval kStatus_Timeout          PHY access timeout.
+ */
+status_t PHY_DP83825_EnableAutoVod(phy_handle_t *handle, const phy_dp83825_vod_auto_config_t *config);
+
+/*!
+ * @brief Runs one step of the automatic DP83826 transmit amplitude.
+ *
+ * Call it periodically, the error counters are compared between two calls.
+ *
+ * @param handle   PHY device handle.
+ * @param levelBp  The amplitude in use.
+ * @retval kStatus_Success                Amplitude updated.
+ * @retval kStatus_NoTransferInProgress   Automatic mode not enabled.
+ * @retval kStatus_Timeout                PHY access timeout.
+ */
+status_t PHY_DP83825_UpdateAutoVod(phy_handle_t *handle, uint16_t *levelBp);
+#endif
+
+/*!
+ * @brief Enables/Disables energy detect power-down.
+ *
+ * While no energy is on the wire the PHY powers down its analog front end, and
+ * PHY_DP83825_GetLinkStatus() reports the link down without accessing the bus. Energy is
+ * signaled by the MISR1 energy detect interrupt, picked up by PHY_DP83825_ClearInterrupt(),
+ * or found by a bus check every idlePolls link polls. Auto-negotiation is then restarted at
+ * once and link polling resumes.
+ *
+ * @param handle     PHY device handle.
+ * @param enable     True to enable, false to disable.
+ * @param idlePolls  Link polls between bus checks while powered down, 0 to rely on the interrupt.
+ * @retval kStatus_Success          Energy detect configured.
+ * @retval kStatus_InvalidArgument  Enabled in fiber mode.
+ * @retval kStatus_Timeout          PHY access timeout.
+ */
+status_t PHY_DP83825_EnableEnergyDetect(phy_handle_t *handle, bool enable, uint16_t idlePolls);
+
+/*!
+ * @brief Gets the energy detect power-down statistics.
+ *
+ * @param handle  PHY device handle.
+ * @param stats   The energy detect statistics.
+ */
+void PHY_DP83825_GetEnergyDetectStats(phy_handle_t *handle, phy_dp83825_energy_stats_t *stats);
+
+#if PHY_DP83825_ENABLE_TELEMETRY
+/*!
+ * @brief Gets the timestamps of the running or last link bring-up.
+ *
+ * @param handle    PHY device handle.
+ * @param timeline  The bring-up timestamps.
+ */
+void PHY_DP83825_GetTimeline(phy_handle_t *handle, phy_dp83825_timeline_t *timeline);
+
+/*!
+ * @brief Gets the phase times aggregated over the completed link bring-ups.
+ *
+ * A bring-up completes when the speed and duplex are read with the link up.
+ *
+ * @param handle  PHY device handle.
+ * @param stats   The phase statistics.
+ */
+void PHY_DP83825_GetPhaseStats(phy_handle_t *handle, phy_dp83825_phase_stats_t *stats);
+
+/*!
+ * @brief Clears the phase statistics.
+ *
+ * @param handle  PHY device handle.
+ */
+void PHY_DP83825_ClearPhaseStats(phy_handle_t *handle);
+#endif
+
+/*!
+ * @brief Configures link flap damping.
+ *
+ * With damping the link events of PHY_DP83825_ProcessInterrupt() are filtered: short link downs
+ * are not reported, an up is reported once it is stable, and a flapping link is held down.
+ * Needs the getTimeUs resource function.
+ *
+ * @param handle  PHY device handle.
+ * @param config  Damping configuration, NULL to report every link change again.
+ * @retval kStatus_Success          Damping configured.
+ * @retval kStatus_InvalidArgument  No time source or the thresholds do not fit together.
+ */
+status_t PHY_DP83825_ConfigureFlapDamping(phy_handle_t *handle, const phy_dp83825_flap_config_t *config);
+
+/*!
+ * @brief Runs the link flap damping timers.
+ *
+ * Reports the link changes whose hold time is over, decays the penalty and releases a held down
+ * link. Does not access the PHY. Call it when the returned time is over, from the same context as
+ * PHY_DP83825_ProcessInterrupt().
+ *
+ * @param handle  PHY device handle.
+ * @return Time in us until the next call is needed, 0 when there is nothing to wait for.
+ */
+uint32_t PHY_DP83825_ProcessFlapTimer(phy_handle_t *handle);
+
+/*!
+ * @brief Gets the link flap damping statistics.
+ *
+ * @param handle  PHY device handle.
+ * @param stats   The statistics.
+ */
+void PHY_DP83825_GetFlapStats(phy_handle_t *handle, phy_dp83825_flap_stats_t *stats);
+
 /*!
  * @brief Enables/Disables PHY link management interrupt.
  *
@@ -187,6 +1455,20 @@ status_t PHY_DP83825_EnableLinkInterrupt(phy_handle_t *handle, phy_interrupt_typ
  */
 status_t PHY_DP83825_ClearInterrupt(phy_handle_t *handle);
 
+/*!
+ * @brief Handles the PHY interrupt.
+ *
+ * Clears the interrupt status and raises kPHY_DP83825_EventLinkUp or kPHY_DP83825_EventLinkDown through
+ * the resource event callback when the link state changed since the last call. Call it from task
+ * context after the INT pin fired, the events are raised from within the call. With flap damping
+ * the events are filtered, see PHY_DP83825_ConfigureFlapDamping().
+ *
+ * @param handle  PHY device handle.
+ * @retval kStatus_Success  Interrupt handled.
+ * @retval kStatus_Timeout  PHY MDIO visit time out
+ */
+status_t PHY_DP83825_ProcessInterrupt(phy_handle_t *handle);
+
 /* @} */
 
 #if defined(__cplusplus)
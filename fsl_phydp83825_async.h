@@ -0,0 +1,727 @@
+/*
+ * fsl_phydp83825_async.h
+ *
+ *  C++20 coroutine interface to the DP83825 PHY on top of a completion based MDIO bus.
+ */
+
+#ifndef _FSL_PHYDP83825_ASYNC_H_
+#define _FSL_PHYDP83825_ASYNC_H_
+
+#if !defined(__cplusplus) || (__cplusplus < 202002L)
+#error "fsl_phydp83825_async.h needs C++20"
+#endif
+
+#include <chrono>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <map>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "fsl_phydp83825.h"
+#include "fsl_phydp83825_regs.h"
+
+/*!
+ * @addtogroup phy_driver
+ * @{
+ */
+
+namespace dp83825
+{
+namespace async
+{
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Polling interval of the diagnostics. */
+constexpr uint32_t kPollUs = 100U;
+
+/*! @brief Status and value of an operation. */
+template <typename T>
+struct Result
+{
+    status_t status; /*!< kStatus_Success when value is valid. */
+    T value;         /*!< Operation result. */
+};
+
+/*! @brief Link state. */
+struct Link
+{
+    bool up;             /*!< Link up. */
+    phy_speed_t speed;   /*!< Resolved speed, valid with the link up. */
+    phy_duplex_t duplex; /*!< Resolved duplex, valid with the link up. */
+};
+
+/*!
+ * @brief MDIO frame completion.
+ *
+ * Called exactly once per frame, from the executor thread. Interrupt driven buses defer the
+ * call to the thread running the executor.
+ */
+struct Completion
+{
+    void (*fn)(void *context, status_t status, uint16_t data); /*!< Completion function. */
+    void *context;                                            /*!< Passed to fn. */
+
+    void operator()(status_t status, uint16_t data) const
+    {
+        fn(context, status, data);
+    }
+};
+
+/*!
+ * @brief Completion based MDIO bus.
+ *
+ * A devAddr of 0 addresses the basic registers, any other value the extended registers of
+ * that MMD device.
+ */
+class Bus
+{
+public:
+    virtual ~Bus() = default;
+
+    /*! @brief Starts a read frame. */
+    virtual void read(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, Completion done) = 0;
+
+    /*! @brief Starts a write frame. */
+    virtual void write(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data, Completion done) = 0;
+};
+
+/*! @brief Bus running the frames through the blocking functions of a resource, they complete in place. */
+class ResourceBus : public Bus
+{
+public:
+    explicit ResourceBus(const phy_dp83825_resource_t &resource) : m_resource(resource)
+    {
+    }
+
+    void read(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, Completion done) override
+    {
+        const phy_dp83825_bus_t *bus = m_resource.bus;
+        uint16_t data                = 0U;
+        status_t status;
+
+        if (bus == nullptr)
+        {
+            status = (devAddr == 0U) ? m_resource.read(phyAddr, (uint8_t)regAddr, &data) :
+                                       m_resource.readExt(phyAddr, devAddr, regAddr, &data);
+        }
+        else
+        {
+            lock(bus, true);
+            status = (devAddr == 0U) ? bus->read(bus->context, phyAddr, (uint8_t)regAddr, &data) :
+                                       bus->readExt(bus->context, phyAddr, devAddr, regAddr, &data);
+            lock(bus, false);
+        }
+        done(status, data);
+    }
+
+    void write(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data, Completion done) override
+    {
+        const phy_dp83825_bus_t *bus = m_resource.bus;
+        status_t status;
+
+        if (bus == nullptr)
+        {
+            status = (devAddr == 0U) ? m_resource.write(phyAddr, (uint8_t)regAddr, data) :
+                                       m_resource.writeExt(phyAddr, devAddr, regAddr, data);
+        }
+        else
+        {
+            lock(bus, true);
+            status = (devAddr == 0U) ? bus->write(bus->context, phyAddr, (uint8_t)regAddr, data) :
+                                       bus->writeExt(bus->context, phyAddr, devAddr, regAddr, data);
+            lock(bus, false);
+        }
+        done(status, data);
+    }
+
+private:
+    static void lock(const phy_dp83825_bus_t *bus, bool take)
+    {
+        phyBusLock fn = take ? bus->lock : bus->unlock;
+
+        if (fn != nullptr)
+        {
+            fn(bus->lockContext);
+        }
+    }
+
+    const phy_dp83825_resource_t &m_resource;
+};
+
+template <typename T>
+class Task;
+
+namespace detail
+{
+/*! @brief Resumes the awaiting coroutine when a task completes. */
+struct FinalAwaiter
+{
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+    {
+        std::coroutine_handle<> continuation = handle.promise().continuation;
+        return (continuation != nullptr) ? continuation : std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+};
+
+struct PromiseBase
+{
+    std::coroutine_handle<> continuation;
+
+    std::suspend_always initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    FinalAwaiter final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void unhandled_exception() const noexcept
+    {
+        std::terminate();
+    }
+};
+
+template <typename T>
+struct Promise : PromiseBase
+{
+    T value{};
+
+    Task<T> get_return_object() noexcept;
+
+    void return_value(T result) noexcept
+    {
+        value = std::move(result);
+    }
+};
+
+template <>
+struct Promise<void> : PromiseBase
+{
+    Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept
+    {
+    }
+};
+
+/*! @brief Coroutine run by Executor::spawn(), destroys itself when done. */
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object() noexcept
+        {
+            return {std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() const noexcept
+        {
+        }
+
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+} /* namespace detail */
+
+/*!
+ * @brief Lazily started coroutine, runs when awaited or spawned.
+ *
+ * @tparam T  Result type.
+ */
+template <typename T = void>
+class [[nodiscard]] Task
+{
+public:
+    using promise_type = detail::Promise<T>;
+    using Handle       = std::coroutine_handle<promise_type>;
+
+    explicit Task(Handle handle) noexcept : m_handle(handle)
+    {
+    }
+
+    Task(Task &&other) noexcept : m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    Task(const Task &)            = delete;
+    Task &operator=(const Task &) = delete;
+    Task &operator=(Task &&)      = delete;
+
+    ~Task()
+    {
+        if (m_handle != nullptr)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        m_handle.promise().continuation = awaiting;
+        return m_handle;
+    }
+
+    T await_resume()
+    {
+        if constexpr (!std::is_void_v<T>)
+        {
+            return std::move(m_handle.promise().value);
+        }
+    }
+
+private:
+    Handle m_handle;
+};
+
+template <typename T>
+Task<T> detail::Promise<T>::get_return_object() noexcept
+{
+    return Task<T>{std::coroutine_handle<Promise<T>>::from_promise(*this)};
+}
+
+inline Task<void> detail::Promise<void>::get_return_object() noexcept
+{
+    return Task<void>{std::coroutine_handle<Promise<void>>::from_promise(*this)};
+}
+
+/*!
+ * @brief Single threaded executor.
+ *
+ * Runs the ready coroutines in order and wakes sleeping ones on time. Run it from one thread,
+ * e.g. the cooperative scheduler loop of the firmware or main() of a host benchmark.
+ */
+class Executor
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /*! @brief Queues a coroutine to be resumed. */
+    void post(std::coroutine_handle<> handle)
+    {
+        m_ready.push_back(handle);
+    }
+
+    /*! @brief Starts a task, it runs to completion without anybody awaiting it. */
+    template <typename T>
+    void spawn(Task<T> task)
+    {
+        post(detach(std::move(task)));
+    }
+
+    /*! @brief Awaitable suspending the coroutine for at least delayUs. */
+    auto sleep(uint32_t delayUs)
+    {
+        struct Sleep
+        {
+            Executor &executor;
+            Clock::time_point deadline;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                executor.m_timers.emplace(deadline, handle);
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+        };
+        return Sleep{*this, Clock::now() + std::chrono::microseconds(delayUs)};
+    }
+
+    /*!
+     * @brief Resumes one coroutine that is ready or whose sleep is over.
+     *
+     * @return false when nothing was ready.
+     */
+    bool runOne()
+    {
+        if (m_ready.empty() && !m_timers.empty() && (m_timers.begin()->first <= Clock::now()))
+        {
+            m_ready.push_back(m_timers.begin()->second);
+            m_timers.erase(m_timers.begin());
+        }
+        if (m_ready.empty())
+        {
+            return false;
+        }
+
+        std::coroutine_handle<> handle = m_ready.front();
+        m_ready.pop_front();
+        handle.resume();
+        return true;
+    }
+
+    /*! @brief Runs until no coroutine is left, sleeps while only timers are pending. */
+    void run()
+    {
+        while (!m_ready.empty() || !m_timers.empty())
+        {
+            if (!runOne() && m_ready.empty() && !m_timers.empty())
+            {
+                std::this_thread::sleep_until(m_timers.begin()->first);
+            }
+        }
+    }
+
+    /*! @brief Whether coroutines are queued or sleeping. */
+    bool busy() const
+    {
+        return !m_ready.empty() || !m_timers.empty();
+    }
+
+private:
+    static std::coroutine_handle<> detach(Task<void> task)
+    {
+        return wrap(std::move(task));
+    }
+
+    template <typename T>
+    static std::coroutine_handle<> detach(Task<T> task)
+    {
+        return wrap(discard(std::move(task)));
+    }
+
+    template <typename T>
+    static Task<void> discard(Task<T> task)
+    {
+        (void)co_await task;
+    }
+
+    static detail::Detached start(Task<void> task)
+    {
+        co_await task;
+    }
+
+    static std::coroutine_handle<> wrap(Task<void> task)
+    {
+        return start(std::move(task)).handle;
+    }
+
+    std::deque<std::coroutine_handle<>> m_ready;
+    std::multimap<Clock::time_point, std::coroutine_handle<>> m_timers;
+};
+
+/*!
+ * @brief Asynchronous DP83825 PHY.
+ *
+ * Every operation is a coroutine issuing its MDIO frames through the bus and suspending until
+ * they complete, so operations on many PHYs can be in flight at once without a thread each.
+ * Operations on the same PHY are not serialized, await one before starting the next. The
+ * class does its own bus accesses, do not mix it with the blocking API on the same PHY.
+ */
+class Phy
+{
+public:
+    Phy(Executor &executor, Bus &bus, uint8_t phyAddr) : m_executor(executor), m_bus(bus), m_phyAddr(phyAddr)
+    {
+    }
+
+    /*! @brief PHY ID read by init(), 0 before. */
+    uint32_t phyId() const
+    {
+        return m_phyId;
+    }
+
+    /*! @brief Reads a register. */
+    Task<Result<uint16_t>> read(uint16_t regAddr, uint8_t devAddr = 0U)
+    {
+        co_return co_await Frame{*this, devAddr, regAddr, 0U, false};
+    }
+
+    /*! @brief Writes a register. */
+    Task<status_t> write(uint16_t regAddr, uint16_t data, uint8_t devAddr = 0U)
+    {
+        Result<uint16_t> frame = co_await Frame{*this, devAddr, regAddr, data, true};
+        co_return frame.status;
+    }
+
+    /*!
+     * @brief Runs a register script.
+     *
+     * Runs the engine of PHY_DP83825_RunScript() through PHY_DP83825_ScriptStep(), with the
+     * same semantics.
+     */
+    Task<status_t> runScript(const phy_dp83825_script_t *script, uint32_t count)
+    {
+        phy_dp83825_script_run_t run;
+        Result<uint16_t> frame{kStatus_Success, 0U};
+
+        PHY_DP83825_ScriptStart(&run, script, count, m_phyId);
+        while (run.action != kPHY_DP83825_ScriptActionDone)
+        {
+            if (run.action == kPHY_DP83825_ScriptActionRead)
+            {
+                frame = co_await read(run.reg, run.devAddr);
+            }
+            else if (run.action == kPHY_DP83825_ScriptActionWrite)
+            {
+                frame.status = co_await write(run.reg, run.value, run.devAddr);
+            }
+            else
+            {
+                co_await m_executor.sleep(run.delayUs);
+                frame.status = kStatus_Success;
+            }
+            (void)PHY_DP83825_ScriptStep(&run, frame.status, frame.value);
+        }
+        co_return run.status;
+    }
+
+    /*! @brief Initializes the PHY like PHY_DP83825_Init(), using the scripts of the driver. */
+    Task<status_t> init(const phy_config_t &config)
+    {
+        static constexpr phy_dp83825_script_id_t kScripts[] = {
+            kPHY_DP83825_ScriptIdReset,
+            kPHY_DP83825_ScriptIdVariantInit,
+            kPHY_DP83825_ScriptIdInit,
+        };
+        const phy_dp83825_script_t *script = nullptr;
+        uint32_t count                     = 0U;
+        status_t status                    = kStatus_Fail;
+
+        /* The PHY may still be coming out of its power-on reset. */
+        for (uint32_t attempt = 0U; (attempt < 1000U) && (script == nullptr); attempt++)
+        {
+            Result<uint16_t> id1 = co_await read(PHY_ID1_REG);
+            Result<uint16_t> id2 = co_await read(PHY_ID2_REG);
+            if ((id1.status != kStatus_Success) || (id2.status != kStatus_Success))
+            {
+                co_return (id1.status != kStatus_Success) ? id1.status : id2.status;
+            }
+            m_phyId = ((uint32_t)id1.value << 16) | id2.value;
+            script  = PHY_DP83825_GetScript(kPHY_DP83825_ScriptIdVariantInit, m_phyId, &count);
+        }
+        if (script == nullptr)
+        {
+            co_return kStatus_Fail;
+        }
+
+        for (phy_dp83825_script_id_t id : kScripts)
+        {
+            script = PHY_DP83825_GetScript(id, m_phyId, &count);
+            status = co_await runScript(script, count);
+            if (status != kStatus_Success)
+            {
+                co_return status;
+            }
+        }
+
+        script = PHY_DP83825_GetScript(config.enableLinkIntr ? kPHY_DP83825_ScriptIdLinkIntrEnable :
+                                                               kPHY_DP83825_ScriptIdLinkIntrDisable,
+                                       m_phyId, &count);
+        status = co_await runScript(script, count);
+        if (status == kStatus_Success)
+        {
+            status = co_await reconfigure(config.autoNeg, config.speed, config.duplex);
+        }
+        co_return status;
+    }
+
+    /*! @brief Reads the link state and the resolved speed and duplex. */
+    Task<Result<Link>> link()
+    {
+        Result<Link> link{kStatus_Success, {false, kPHY_Speed10M, kPHY_HalfDuplex}};
+        Result<uint16_t> bmsr = co_await read(PHY_BASICSTATUS_REG);
+        Result<uint16_t> physts{kStatus_Success, 0U};
+
+        link.status = bmsr.status;
+        if ((bmsr.status == kStatus_Success) && ((bmsr.value & PHY_BSTATUS_LINKSTATUS_MASK) != 0U))
+        {
+            physts      = co_await read(MII_DP83822_PHYSTS);
+            link.status = physts.status;
+            link.value  = {true, ((physts.value & DP83822_PHYSTS_10) != 0U) ? kPHY_Speed10M : kPHY_Speed100M,
+                           ((physts.value & DP83822_PHYSTS_DUPLEX) != 0U) ? kPHY_FullDuplex : kPHY_HalfDuplex};
+        }
+        co_return link;
+    }
+
+    /*! @brief Restarts auto-negotiation or forces speed and duplex. */
+    Task<status_t> reconfigure(bool autoNeg, phy_speed_t speed, phy_duplex_t duplex)
+    {
+        const phy_dp83825_script_t *script = nullptr;
+        uint32_t count                     = 0U;
+
+        if (autoNeg)
+        {
+            script = PHY_DP83825_GetScript(kPHY_DP83825_ScriptIdAutoNeg, m_phyId, &count);
+            co_return co_await runScript(script, count);
+        }
+
+        const phy_dp83825_script_t forced[] = {
+            dp83825::script(BMCR_ISOLATE::set<0U>() | BMCR_AUTONEG::set<0U>() |
+                            BMCR_SPEED::prep((speed == kPHY_Speed100M) ? 1U : 0U) |
+                            BMCR_DUPLEX::prep((duplex == kPHY_FullDuplex) ? 1U : 0U)),
+        };
+        co_return co_await runScript(forced, 1U);
+    }
+
+    /*!
+     * @brief Selects a loopback point, see PHY_DP83825_GetLoopbackScript().
+     *
+     * kPHY_DP83825_LoopbackNone clears the loopback, the forced speed and duplex stay until
+     * reconfigure().
+     */
+    Task<status_t> loopback(phy_dp83825_loopback_t loopback, phy_speed_t speed)
+    {
+        phy_dp83825_script_t script[PHY_DP83825_LOOPBACK_SCRIPT_COUNT];
+        uint32_t count = PHY_DP83825_GetLoopbackScript(loopback, speed, script);
+
+        co_return co_await runScript(script, count);
+    }
+
+#if PHY_DP83825_ENABLE_DIAGNOSTICS
+    /*! @brief Runs the cable diagnostic, see PHY_DP83825_StartCableDiag(). */
+    Task<Result<phy_dp83825_cable_diag_t>> cableDiag(uint32_t timeoutUs = 200000U)
+    {
+        Result<phy_dp83825_cable_diag_t> diag{kStatus_Success, {}};
+        uint16_t raw[PHY_DP83825_CABLE_RESULT_REGS];
+        Executor::Clock::time_point start = Executor::Clock::now();
+
+        diag.status = co_await write(MII_DP83822_CDCR, DP83822_CDCR_START);
+        if (diag.status == kStatus_Success)
+        {
+            diag.status = co_await wait(MII_DP83822_CDCR, 0U, DP83822_CDCR_DONE, DP83822_CDCR_DONE, timeoutUs);
+        }
+        for (uint16_t index = 0U; (index < PHY_DP83825_CABLE_RESULT_REGS) && (diag.status == kStatus_Success); index++)
+        {
+            Result<uint16_t> frame = co_await read(MII_DP83822_CDLRR1 + index, DP83822_DEVADDR);
+            diag.status            = frame.status;
+            raw[index]             = frame.value;
+        }
+        if (diag.status == kStatus_Success)
+        {
+            PHY_DP83825_DecodeCableDiag(raw, &diag.value);
+            diag.value.runTimeUs = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                                       Executor::Clock::now() - start)
+                                       .count();
+        }
+        co_return diag;
+    }
+#endif
+
+private:
+    /*! @brief One MDIO frame, resumes the awaiting coroutine from the executor on completion. */
+    struct Frame
+    {
+        Phy &phy;
+        uint8_t devAddr;
+        uint16_t regAddr;
+        uint16_t data;
+        bool isWrite;
+        Result<uint16_t> result{kStatus_Success, 0U};
+        std::coroutine_handle<> awaiting{};
+        bool done = false;
+
+        static void complete(void *context, status_t status, uint16_t value)
+        {
+            Frame *frame  = static_cast<Frame *>(context);
+            frame->result = {status, value};
+            frame->done   = true;
+            if (frame->awaiting != nullptr)
+            {
+                frame->phy.m_executor.post(frame->awaiting);
+            }
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle)
+        {
+            Completion completion{&Frame::complete, this};
+
+            if (isWrite)
+            {
+                phy.m_bus.write(phy.m_phyAddr, devAddr, regAddr, data, completion);
+            }
+            else
+            {
+                phy.m_bus.read(phy.m_phyAddr, devAddr, regAddr, completion);
+            }
+            /* Buses completing in place do not need the executor. */
+            if (done)
+            {
+                return false;
+            }
+            awaiting = handle;
+            return true;
+        }
+
+        Result<uint16_t> await_resume() const noexcept
+        {
+            return result;
+        }
+    };
+
+    Task<status_t> wait(uint16_t regAddr, uint8_t devAddr, uint16_t mask, uint16_t value, uint32_t timeoutUs)
+    {
+        for (uint32_t polls = timeoutUs / kPollUs;; polls--)
+        {
+            Result<uint16_t> frame = co_await read(regAddr, devAddr);
+            if ((frame.status == kStatus_Success) && ((frame.value & mask) == value))
+            {
+                co_return kStatus_Success;
+            }
+            if (polls == 0U)
+            {
+                co_return (frame.status != kStatus_Success) ? frame.status : kStatus_Timeout;
+            }
+            co_await m_executor.sleep(kPollUs);
+        }
+    }
+
+    Executor &m_executor;
+    Bus &m_bus;
+    uint8_t m_phyAddr;
+    uint32_t m_phyId = 0U;
+};
+} /* namespace async */
+} /* namespace dp83825 */
+
+/*! @}*/
+
+#endif /* _FSL_PHYDP83825_ASYNC_H_ */
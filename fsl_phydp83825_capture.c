@@ -0,0 +1,390 @@
+/*
+ * fsl_phydp83825_capture.c
+ *
+ *  MDIO capture and replay for the DP83825 PHY driver.
+ */
+
+#include "fsl_phydp83825_capture.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Resource functions replaced by the capture or the replay. */
+typedef struct _phy_dp83825_capture_saved
+{
+    mdioWrite write;
+    mdioRead read;
+    mdioWriteExt writeExt;
+    mdioReadExt readExt;
+    phyGetTimeUs getTimeUs;
+    phyDelayUs delayUs;
+    const phy_dp83825_bus_t *bus;
+} phy_dp83825_capture_saved_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static status_t PHY_DP83825_CaptureWrite(uint8_t phyAddr, uint8_t regAddr, uint16_t data);
+static status_t PHY_DP83825_CaptureRead(uint8_t phyAddr, uint8_t regAddr, uint16_t *pData);
+static status_t PHY_DP83825_CaptureWriteExt(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data);
+static status_t PHY_DP83825_CaptureReadExt(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData);
+static status_t PHY_DP83825_CaptureBusWrite(void *context, uint8_t phyAddr, uint8_t regAddr, uint16_t data);
+static status_t PHY_DP83825_CaptureBusRead(void *context, uint8_t phyAddr, uint8_t regAddr, uint16_t *pData);
+static status_t PHY_DP83825_CaptureBusWriteExt(
+    void *context, uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data);
+static status_t PHY_DP83825_CaptureBusReadExt(
+    void *context, uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData);
+static status_t PHY_DP83825_ReplayWrite(uint8_t phyAddr, uint8_t regAddr, uint16_t data);
+static status_t PHY_DP83825_ReplayRead(uint8_t phyAddr, uint8_t regAddr, uint16_t *pData);
+static status_t PHY_DP83825_ReplayWriteExt(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data);
+static status_t PHY_DP83825_ReplayReadExt(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData);
+static uint32_t PHY_DP83825_ReplayGetTimeUs(void);
+static void PHY_DP83825_ReplayDelayUs(uint32_t delayUs);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* The resource functions take no context, so the capture and the replay state are global. */
+static phy_dp83825_capture_saved_t s_captureSaved;
+static phy_dp83825_capture_sink_t s_captureSink;
+static phy_dp83825_bus_t s_captureBus;
+
+static phy_dp83825_capture_saved_t s_replaySaved;
+static const uint8_t *s_replayData;
+static uint32_t s_replayCount;
+static uint32_t s_replayClockUs;
+static bool s_replayTiming;
+static phy_dp83825_divergence_t s_replayDivergence;
+static phy_dp83825_replay_stats_t s_replayStats;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void PHY_DP83825_SaveResource(phy_dp83825_capture_saved_t *saved, const phy_dp83825_resource_t *resource)
+{
+    saved->write     = resource->write;
+    saved->read      = resource->read;
+    saved->writeExt  = resource->writeExt;
+    saved->readExt   = resource->readExt;
+    saved->getTimeUs = resource->getTimeUs;
+    saved->delayUs   = resource->delayUs;
+    saved->bus       = resource->bus;
+}
+
+static void PHY_DP83825_RestoreResource(phy_dp83825_resource_t *resource, const phy_dp83825_capture_saved_t *saved)
+{
+    resource->write     = saved->write;
+    resource->read      = saved->read;
+    resource->writeExt  = saved->writeExt;
+    resource->readExt   = saved->readExt;
+    resource->getTimeUs = saved->getTimeUs;
+    resource->delayUs   = saved->delayUs;
+    resource->bus       = saved->bus;
+}
+
+static uint32_t PHY_DP83825_CaptureTime(void)
+{
+    return (s_captureSaved.getTimeUs != NULL) ? s_captureSaved.getTimeUs() : 0U;
+}
+
+static void PHY_DP83825_CaptureEmit(uint8_t phyAddr,
+                                    uint8_t op,
+                                    uint8_t devAddr,
+                                    uint16_t regAddr,
+                                    uint16_t value,
+                                    status_t status,
+                                    uint32_t start)
+{
+    phy_dp83825_trace_record_t record;
+    uint8_t encoded[PHY_DP83825_TRACE_RECORD_SIZE];
+    uint32_t duration = PHY_DP83825_CaptureTime() - start;
+
+    record.timestamp = start;
+    record.regAddr   = regAddr;
+    record.value     = value;
+    record.duration  = (duration > 0xFFFFU) ? 0xFFFFU : (uint16_t)duration;
+    record.phyAddr   = phyAddr;
+    record.devAddr   = devAddr;
+    record.op        = op;
+    record.status    = (uint16_t)status;
+    PHY_DP83825_TraceEncode(&record, encoded);
+    s_captureSink(encoded, sizeof(encoded));
+}
+
+static status_t PHY_DP83825_CaptureWrite(uint8_t phyAddr, uint8_t regAddr, uint16_t data)
+{
+    uint32_t start  = PHY_DP83825_CaptureTime();
+    status_t result = s_captureSaved.write(phyAddr, regAddr, data);
+
+    PHY_DP83825_CaptureEmit(phyAddr, PHY_DP83825_TRACE_OP_WRITE, 0U, regAddr, data, result, start);
+    return result;
+}
+
+static status_t PHY_DP83825_CaptureRead(uint8_t phyAddr, uint8_t regAddr, uint16_t *pData)
+{
+    uint32_t start  = PHY_DP83825_CaptureTime();
+    status_t result = s_captureSaved.read(phyAddr, regAddr, pData);
+
+    PHY_DP83825_CaptureEmit(phyAddr, PHY_DP83825_TRACE_OP_READ, 0U, regAddr, *pData, result, start);
+    return result;
+}
+
+static status_t PHY_DP83825_CaptureWriteExt(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data)
+{
+    uint32_t start  = PHY_DP83825_CaptureTime();
+    status_t result = s_captureSaved.writeExt(phyAddr, devAddr, regAddr, data);
+
+    PHY_DP83825_CaptureEmit(phyAddr, PHY_DP83825_TRACE_OP_WRITE_EXT, devAddr, regAddr, data, result, start);
+    return result;
+}
+
+static status_t PHY_DP83825_CaptureReadExt(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData)
+{
+    uint32_t start  = PHY_DP83825_CaptureTime();
+    status_t result = s_captureSaved.readExt(phyAddr, devAddr, regAddr, pData);
+
+    PHY_DP83825_CaptureEmit(phyAddr, PHY_DP83825_TRACE_OP_READ_EXT, devAddr, regAddr, *pData, result, start);
+    return result;
+}
+
+static status_t PHY_DP83825_CaptureBusWrite(void *context, uint8_t phyAddr, uint8_t regAddr, uint16_t data)
+{
+    uint32_t start  = PHY_DP83825_CaptureTime();
+    status_t result = s_captureSaved.bus->write(context, phyAddr, regAddr, data);
+
+    PHY_DP83825_CaptureEmit(phyAddr, PHY_DP83825_TRACE_OP_WRITE, 0U, regAddr, data, result, start);
+    return result;
+}
+
+static status_t PHY_DP83825_CaptureBusRead(void *context, uint8_t phyAddr, uint8_t regAddr, uint16_t *pData)
+{
+    uint32_t start  = PHY_DP83825_CaptureTime();
+    status_t result = s_captureSaved.bus->read(context, phyAddr, regAddr, pData);
+
+    PHY_DP83825_CaptureEmit(phyAddr, PHY_DP83825_TRACE_OP_READ, 0U, regAddr, *pData, result, start);
+    return result;
+}
+
+static status_t PHY_DP83825_CaptureBusWriteExt(
+    void *context, uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data)
+{
+    uint32_t start  = PHY_DP83825_CaptureTime();
+    status_t result = s_captureSaved.bus->writeExt(context, phyAddr, devAddr, regAddr, data);
+
+    PHY_DP83825_CaptureEmit(phyAddr, PHY_DP83825_TRACE_OP_WRITE_EXT, devAddr, regAddr, data, result, start);
+    return result;
+}
+
+static status_t PHY_DP83825_CaptureBusReadExt(
+    void *context, uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData)
+{
+    uint32_t start  = PHY_DP83825_CaptureTime();
+    status_t result = s_captureSaved.bus->readExt(context, phyAddr, devAddr, regAddr, pData);
+
+    PHY_DP83825_CaptureEmit(phyAddr, PHY_DP83825_TRACE_OP_READ_EXT, devAddr, regAddr, *pData, result, start);
+    return result;
+}
+
+void PHY_DP83825_CaptureStart(phy_dp83825_resource_t *resource, phy_dp83825_capture_sink_t sink)
+{
+    assert(resource && sink);
+
+    uint8_t header[PHY_DP83825_TRACE_HEADER_SIZE];
+
+    PHY_DP83825_SaveResource(&s_captureSaved, resource);
+    s_captureSink = sink;
+
+    PHY_DP83825_TraceEncodeHeader(header, PHY_DP83825_TRACE_STREAM, 0U);
+    sink(header, sizeof(header));
+
+    resource->write    = PHY_DP83825_CaptureWrite;
+    resource->read     = PHY_DP83825_CaptureRead;
+    resource->writeExt = PHY_DP83825_CaptureWriteExt;
+    resource->readExt  = PHY_DP83825_CaptureReadExt;
+    if (resource->bus != NULL)
+    {
+        /* The bus keeps its context and lock, only the frames pass through the capture. */
+        s_captureBus          = *resource->bus;
+        s_captureBus.write    = PHY_DP83825_CaptureBusWrite;
+        s_captureBus.read     = PHY_DP83825_CaptureBusRead;
+        s_captureBus.writeExt = PHY_DP83825_CaptureBusWriteExt;
+        s_captureBus.readExt  = PHY_DP83825_CaptureBusReadExt;
+        resource->bus         = &s_captureBus;
+    }
+}
+
+void PHY_DP83825_CaptureStop(phy_dp83825_resource_t *resource)
+{
+    assert(resource);
+
+    PHY_DP83825_RestoreResource(resource, &s_captureSaved);
+    s_captureSink = NULL;
+}
+
+static uint32_t PHY_DP83825_CaptureGet32(const uint8_t *in)
+{
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8U) | ((uint32_t)in[2] << 16U) | ((uint32_t)in[3] << 24U);
+}
+
+static void PHY_DP83825_ReplayWait(uint32_t delayUs)
+{
+    if (!s_replayTiming || (delayUs == 0U))
+    {
+        return;
+    }
+    if (s_replaySaved.delayUs != NULL)
+    {
+        s_replaySaved.delayUs(delayUs);
+    }
+    else
+    {
+        SDK_DelayAtLeastUs(delayUs, SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY);
+    }
+}
+
+static status_t PHY_DP83825_ReplayFrame(
+    uint8_t phyAddr, uint8_t op, uint8_t devAddr, uint16_t regAddr, uint16_t *data)
+{
+    phy_dp83825_trace_record_t expected;
+    phy_dp83825_trace_record_t actual;
+    bool read = (op == PHY_DP83825_TRACE_OP_READ) || (op == PHY_DP83825_TRACE_OP_READ_EXT);
+
+    if (s_replayStats.frames >= s_replayCount)
+    {
+        s_replayStats.exhausted = true;
+        return kStatus_Fail;
+    }
+    PHY_DP83825_TraceDecode(
+        &s_replayData[PHY_DP83825_TRACE_HEADER_SIZE + (s_replayStats.frames * PHY_DP83825_TRACE_RECORD_SIZE)],
+        &expected);
+
+    if ((expected.op != op) || (expected.phyAddr != phyAddr) || (expected.regAddr != regAddr) ||
+        ((op >= PHY_DP83825_TRACE_OP_WRITE_EXT) && (expected.devAddr != devAddr)) ||
+        (!read && (expected.value != *data)))
+    {
+        if (s_replayStats.divergences == 0U)
+        {
+            s_replayStats.firstDivergence = s_replayStats.frames;
+        }
+        s_replayStats.divergences++;
+        if (s_replayDivergence != NULL)
+        {
+            actual           = expected;
+            actual.op        = op;
+            actual.phyAddr   = phyAddr;
+            actual.devAddr   = devAddr;
+            actual.regAddr   = regAddr;
+            actual.value     = read ? 0U : *data;
+            actual.timestamp = s_replayClockUs;
+            s_replayDivergence(s_replayStats.frames, &expected, &actual);
+        }
+    }
+
+    if (read)
+    {
+        *data = expected.value;
+    }
+    s_replayStats.frames++;
+    s_replayClockUs += expected.duration;
+    s_replayStats.elapsedUs += expected.duration;
+    PHY_DP83825_ReplayWait(expected.duration);
+    return (status_t)expected.status;
+}
+
+static status_t PHY_DP83825_ReplayWrite(uint8_t phyAddr, uint8_t regAddr, uint16_t data)
+{
+    return PHY_DP83825_ReplayFrame(phyAddr, PHY_DP83825_TRACE_OP_WRITE, 0U, regAddr, &data);
+}
+
+static status_t PHY_DP83825_ReplayRead(uint8_t phyAddr, uint8_t regAddr, uint16_t *pData)
+{
+    return PHY_DP83825_ReplayFrame(phyAddr, PHY_DP83825_TRACE_OP_READ, 0U, regAddr, pData);
+}
+
+static status_t PHY_DP83825_ReplayWriteExt(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data)
+{
+    return PHY_DP83825_ReplayFrame(phyAddr, PHY_DP83825_TRACE_OP_WRITE_EXT, devAddr, regAddr, &data);
+}
+
+static status_t PHY_DP83825_ReplayReadExt(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData)
+{
+    return PHY_DP83825_ReplayFrame(phyAddr, PHY_DP83825_TRACE_OP_READ_EXT, devAddr, regAddr, pData);
+}
+
+static uint32_t PHY_DP83825_ReplayGetTimeUs(void)
+{
+    return s_replayClockUs;
+}
+
+static void PHY_DP83825_ReplayDelayUs(uint32_t delayUs)
+{
+    s_replayClockUs += delayUs;
+    s_replayStats.elapsedUs += delayUs;
+    PHY_DP83825_ReplayWait(delayUs);
+}
+
+status_t PHY_DP83825_ReplayStart(phy_dp83825_resource_t *resource,
+                                 const uint8_t *capture,
+                                 uint32_t size,
+                                 bool timing,
+                                 phy_dp83825_divergence_t divergence)
+{
+    assert(resource && capture);
+
+    uint32_t count;
+
+    if ((size < PHY_DP83825_TRACE_HEADER_SIZE) || (memcmp(capture, PHY_DP83825_TRACE_MAGIC, 4U) != 0) ||
+        (capture[4] == 0U) || (capture[4] > PHY_DP83825_TRACE_VERSION) ||
+        (capture[5] != PHY_DP83825_TRACE_RECORD_SIZE))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Captures are streamed without a count, take whatever was written. */
+    count = (size - PHY_DP83825_TRACE_HEADER_SIZE) / PHY_DP83825_TRACE_RECORD_SIZE;
+    if (PHY_DP83825_CaptureGet32(&capture[8]) < count)
+    {
+        count = PHY_DP83825_CaptureGet32(&capture[8]);
+    }
+
+    PHY_DP83825_SaveResource(&s_replaySaved, resource);
+    s_replayData       = capture;
+    s_replayCount      = count;
+    s_replayTiming     = timing;
+    s_replayDivergence = divergence;
+    s_replayClockUs    = 0U;
+    (void)memset(&s_replayStats, 0, sizeof(s_replayStats));
+    if (count != 0U)
+    {
+        /* Start the clock at the capture time for comparable timestamps. */
+        s_replayClockUs = PHY_DP83825_CaptureGet32(&capture[PHY_DP83825_TRACE_HEADER_SIZE]);
+    }
+
+    resource->write     = PHY_DP83825_ReplayWrite;
+    resource->read      = PHY_DP83825_ReplayRead;
+    resource->writeExt  = PHY_DP83825_ReplayWriteExt;
+    resource->readExt   = PHY_DP83825_ReplayReadExt;
+    resource->getTimeUs = PHY_DP83825_ReplayGetTimeUs;
+    resource->delayUs   = PHY_DP83825_ReplayDelayUs;
+    resource->bus       = NULL;
+    return kStatus_Success;
+}
+
+void PHY_DP83825_ReplayGetStats(phy_dp83825_replay_stats_t *stats)
+{
+    assert(stats);
+
+    *stats = s_replayStats;
+}
+
+void PHY_DP83825_ReplayStop(phy_dp83825_resource_t *resource)
+{
+    assert(resource);
+
+    PHY_DP83825_RestoreResource(resource, &s_replaySaved);
+    s_replayData = NULL;
+}
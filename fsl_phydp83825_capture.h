@@ -0,0 +1,109 @@
+/*
+ * fsl_phydp83825_capture.h
+ *
+ *  MDIO capture and replay for the DP83825 PHY driver.
+ */
+
+#ifndef _FSL_PHYDP83825_CAPTURE_H_
+#define _FSL_PHYDP83825_CAPTURE_H_
+
+#include "fsl_phydp83825.h"
+#include "fsl_phydp83825_trace.h"
+
+/*!
+ * @addtogroup phy_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Capture sink, receives the capture in the trace dump format as it is recorded. */
+typedef void (*phy_dp83825_capture_sink_t)(const uint8_t *data, uint32_t length);
+
+/*! @brief Divergence callback, called for each frame not matching the capture. */
+typedef void (*phy_dp83825_divergence_t)(uint32_t index,
+                                         const phy_dp83825_trace_record_t *expected,
+                                         const phy_dp83825_trace_record_t *actual);
+
+/*! @brief Replay statistics. */
+typedef struct _phy_dp83825_replay_stats
+{
+    uint32_t frames;          /*!< Frames served. */
+    uint32_t divergences;     /*!< Frames not matching the capture. */
+    uint32_t firstDivergence; /*!< Index of the first diverging frame. */
+    uint32_t elapsedUs;       /*!< Replay clock, recorded frame durations plus driver delays. */
+    bool exhausted;           /*!< The driver ran past the end of the capture. */
+} phy_dp83825_replay_stats_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Starts recording the MDIO frames of a resource.
+ *
+ * The resource access functions are wrapped, every frame is passed to the sink with its
+ * response, status, timestamp and duration. A single capture can run at a time.
+ *
+ * @param resource  PHY resource, its access functions must be set.
+ * @param sink      Capture sink.
+ */
+void PHY_DP83825_CaptureStart(phy_dp83825_resource_t *resource, phy_dp83825_capture_sink_t sink);
+
+/*!
+ * @brief Stops recording and restores the resource access functions.
+ *
+ * @param resource  PHY resource.
+ */
+void PHY_DP83825_CaptureStop(phy_dp83825_resource_t *resource);
+
+/*!
+ * @brief Replays a capture to the driver.
+ *
+ * The resource access functions, time source and delay are replaced. Frames are answered with
+ * the recorded responses in order. A frame whose operation, address, register or written value
+ * differs from the capture is counted as a divergence and still answered from the capture. The
+ * replay clock advances by the recorded frame durations and the driver delays, which makes
+ * frame counts and driver latency deterministic. A single replay can run at a time.
+ *
+ * @param resource    PHY resource.
+ * @param capture     Capture in the trace dump format, kept until the replay stops.
+ * @param size        Capture size in bytes.
+ * @param timing      Also wait the recorded frame durations and the driver delays.
+ * @param divergence  Optional divergence callback.
+ * @retval kStatus_Success          The replay is started.
+ * @retval kStatus_InvalidArgument  Not a capture.
+ */
+status_t PHY_DP83825_ReplayStart(phy_dp83825_resource_t *resource,
+                                 const uint8_t *capture,
+                                 uint32_t size,
+                                 bool timing,
+                                 phy_dp83825_divergence_t divergence);
+
+/*!
+ * @brief Gets the replay statistics.
+ *
+ * @param stats  The replay statistics.
+ */
+void PHY_DP83825_ReplayGetStats(phy_dp83825_replay_stats_t *stats);
+
+/*!
+ * @brief Stops replaying and restores the resource.
+ *
+ * @param resource  PHY resource.
+ */
+void PHY_DP83825_ReplayStop(phy_dp83825_resource_t *resource);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_PHYDP83825_CAPTURE_H_ */
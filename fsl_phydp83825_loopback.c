@@ -0,0 +1,352 @@
+/*
+ * fsl_phydp83825_loopback.c
+ *
+ *  Loopback datapath qualification for the DP83825 PHY driver.
+ */
+
+#include "fsl_phydp83825_loopback.h"
+
+#if PHY_DP83825_ENABLE_LOOPBACK
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Time for the loopback path to settle after it is selected. */
+#define PHY_DP83825_LOOPBACK_SETTLE_US (10000U)
+
+/*! @brief Local experimental EtherType, keeps the test frames out of any protocol stack. */
+#define PHY_DP83825_LOOPBACK_ETHERTYPE (0x88B5U)
+
+/*! @brief Offset of the sequence number in the test frame. */
+#define PHY_DP83825_LOOPBACK_SEQ_OFFSET (14U)
+
+#if (PHY_DP83825_LOOPBACK_MAX_WINDOW == 0U) || ((PHY_DP83825_LOOPBACK_MAX_WINDOW % 32U) != 0U)
+#error "PHY_DP83825_LOOPBACK_MAX_WINDOW must be a non-zero multiple of 32"
+#endif
+
+/*! @brief Bit of a sequence number in s_loopbackPending. */
+#define PHY_DP83825_LOOPBACK_WORD(seq) (((seq) % PHY_DP83825_LOOPBACK_MAX_WINDOW) / 32U)
+#define PHY_DP83825_LOOPBACK_BIT(seq)  ((uint32_t)1U << ((seq) % 32U))
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Frame buffers are too large for the stack of a typical task, the test is not reentrant. */
+static uint8_t s_loopbackTx[PHY_DP83825_LOOPBACK_MAX_FRAME];
+static uint8_t s_loopbackRx[PHY_DP83825_LOOPBACK_MAX_FRAME + 4U];
+
+/*! @brief Frames of the throughput window still expected back, one bit per sequence number. */
+static uint32_t s_loopbackPending[PHY_DP83825_LOOPBACK_MAX_WINDOW / 32U];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t PHY_DP83825_LoopbackTime(phy_handle_t *handle)
+{
+    return ((phy_dp83825_resource_t *)handle->resource)->getTimeUs();
+}
+
+static void PHY_DP83825_LoopbackDelay(phy_handle_t *handle, uint32_t delayUs)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)handle->resource;
+
+    if (resource->delayUs != NULL)
+    {
+        resource->delayUs(delayUs);
+    }
+    else
+    {
+        SDK_DelayAtLeastUs(delayUs, SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY);
+    }
+}
+
+static void PHY_DP83825_LoopbackBuild(uint8_t *frame, uint32_t length, uint32_t seq)
+{
+    uint32_t index;
+
+    /* Broadcast from a locally administered address, so every MAC filter lets it through. */
+    (void)memset(frame, 0xFF, 6U);
+    frame[6]  = 0x02U;
+    frame[7]  = 0x00U;
+    frame[8]  = 0x00U;
+    frame[9]  = 0x00U;
+    frame[10] = 0x00U;
+    frame[11] = 0x01U;
+    frame[12] = (uint8_t)(PHY_DP83825_LOOPBACK_ETHERTYPE >> 8U);
+    frame[13] = (uint8_t)PHY_DP83825_LOOPBACK_ETHERTYPE;
+    frame[14] = (uint8_t)(seq >> 24U);
+    frame[15] = (uint8_t)(seq >> 16U);
+    frame[16] = (uint8_t)(seq >> 8U);
+    frame[17] = (uint8_t)seq;
+    for (index = PHY_DP83825_LOOPBACK_SEQ_OFFSET + 4U; index < length; index++)
+    {
+        frame[index] = (uint8_t)(seq + index);
+    }
+}
+
+static uint32_t PHY_DP83825_LoopbackSeq(const uint8_t *frame)
+{
+    const uint8_t *seq = &frame[PHY_DP83825_LOOPBACK_SEQ_OFFSET];
+
+    return ((uint32_t)seq[0] << 24U) | ((uint32_t)seq[1] << 16U) | ((uint32_t)seq[2] << 8U) | (uint32_t)seq[3];
+}
+
+/* Returns true if a test frame came back, sets *intact if it carries the expected payload. */
+static bool PHY_DP83825_LoopbackReceive(const phy_dp83825_loopback_port_t *port,
+                                        const phy_dp83825_loopback_test_t *test,
+                                        uint32_t *seq,
+                                        bool *intact)
+{
+    uint32_t length = sizeof(s_loopbackRx);
+
+    if (port->receive(port->context, s_loopbackRx, &length) != kStatus_Success)
+    {
+        return false;
+    }
+    /* MACs may hand over the FCS or padding, only compare the test frame itself. */
+    if ((length < test->frameLength) || (s_loopbackRx[12] != (uint8_t)(PHY_DP83825_LOOPBACK_ETHERTYPE >> 8U)) ||
+        (s_loopbackRx[13] != (uint8_t)PHY_DP83825_LOOPBACK_ETHERTYPE))
+    {
+        *seq    = 0xFFFFFFFFU;
+        *intact = false;
+        return true;
+    }
+    *seq = PHY_DP83825_LoopbackSeq(s_loopbackRx);
+    PHY_DP83825_LoopbackBuild(s_loopbackTx, test->frameLength, *seq);
+    *intact = (memcmp(s_loopbackTx, s_loopbackRx, test->frameLength) == 0);
+    return true;
+}
+
+static status_t PHY_DP83825_LoopbackSend(phy_handle_t *handle,
+                                         const phy_dp83825_loopback_port_t *port,
+                                         const phy_dp83825_loopback_test_t *test,
+                                         uint32_t seq,
+                                         bool wait)
+{
+    uint32_t start = PHY_DP83825_LoopbackTime(handle);
+    status_t result;
+
+    PHY_DP83825_LoopbackBuild(s_loopbackTx, test->frameLength, seq);
+    do
+    {
+        result = port->send(port->context, s_loopbackTx, test->frameLength);
+    } while (wait && (result == kStatus_Busy) && ((PHY_DP83825_LoopbackTime(handle) - start) < test->timeoutUs));
+    return result;
+}
+
+static void PHY_DP83825_LoopbackLatency(phy_handle_t *handle,
+                                        const phy_dp83825_loopback_port_t *port,
+                                        const phy_dp83825_loopback_test_t *test,
+                                        phy_dp83825_loopback_result_t *result)
+{
+    uint64_t total = 0U;
+    uint32_t count = 0U;
+    uint32_t seq;
+    uint32_t rxSeq;
+    uint32_t start;
+    uint32_t latency;
+    bool intact;
+    bool done;
+
+    for (seq = 0U; seq < test->frames; seq++)
+    {
+        start = PHY_DP83825_LoopbackTime(handle);
+        if (PHY_DP83825_LoopbackSend(handle, port, test, seq, true) != kStatus_Success)
+        {
+            result->lost++;
+            continue;
+        }
+        result->sent++;
+
+        done = false;
+        while (!done)
+        {
+            latency = PHY_DP83825_LoopbackTime(handle) - start;
+            /* Late frames of an earlier round were already counted as lost, they must not hold off the timeout. */
+            if (PHY_DP83825_LoopbackReceive(port, test, &rxSeq, &intact) && (rxSeq == seq))
+            {
+                done = true;
+                if (!intact)
+                {
+                    result->corrupted++;
+                    continue;
+                }
+                result->received++;
+                total += latency;
+                count++;
+                if ((count == 1U) || (latency < result->minLatencyUs))
+                {
+                    result->minLatencyUs = latency;
+                }
+                if (latency > result->maxLatencyUs)
+                {
+                    result->maxLatencyUs = latency;
+                }
+            }
+            else if (latency >= test->timeoutUs)
+            {
+                done = true;
+                result->lost++;
+            }
+        }
+    }
+    result->avgLatencyUs = (count != 0U) ? (uint32_t)(total / count) : 0U;
+}
+
+static void PHY_DP83825_LoopbackThroughput(phy_handle_t *handle,
+                                           const phy_dp83825_loopback_port_t *port,
+                                           const phy_dp83825_loopback_test_t *test,
+                                           phy_dp83825_loopback_result_t *result)
+{
+    /* Sequence numbers above the latency run, late frames of that run are ignored. */
+    uint32_t end      = test->frames + test->frames;
+    uint32_t next     = test->frames;
+    uint32_t live     = next; /* Lowest sequence number still expected back, the window slides with it. */
+    uint32_t inFlight = 0U;
+    uint32_t received = 0U;
+    uint32_t start    = PHY_DP83825_LoopbackTime(handle);
+    uint32_t progress = start;
+    uint32_t elapsed;
+    uint32_t rxSeq;
+    bool intact;
+
+    (void)memset(s_loopbackPending, 0, sizeof(s_loopbackPending));
+    while ((next < end) || (inFlight != 0U))
+    {
+        while (((next - live) < test->window) && (next < end) &&
+               (PHY_DP83825_LoopbackSend(handle, port, test, next, false) == kStatus_Success))
+        {
+            s_loopbackPending[PHY_DP83825_LOOPBACK_WORD(next)] |= PHY_DP83825_LOOPBACK_BIT(next);
+            next++;
+            inFlight++;
+            result->sent++;
+            progress = PHY_DP83825_LoopbackTime(handle);
+        }
+
+        /*
+         * Frames of an expired window fall below live and duplicates find their bit already cleared, both are
+         * ignored without holding off the timeout.
+         */
+        if (PHY_DP83825_LoopbackReceive(port, test, &rxSeq, &intact) && (rxSeq >= live) && (rxSeq < next) &&
+            ((s_loopbackPending[PHY_DP83825_LOOPBACK_WORD(rxSeq)] & PHY_DP83825_LOOPBACK_BIT(rxSeq)) != 0U))
+        {
+            s_loopbackPending[PHY_DP83825_LOOPBACK_WORD(rxSeq)] &= ~PHY_DP83825_LOOPBACK_BIT(rxSeq);
+            inFlight--;
+            while ((live < next) &&
+                   ((s_loopbackPending[PHY_DP83825_LOOPBACK_WORD(live)] & PHY_DP83825_LOOPBACK_BIT(live)) == 0U))
+            {
+                live++;
+            }
+            progress = PHY_DP83825_LoopbackTime(handle);
+            if (intact)
+            {
+                received++;
+            }
+            else
+            {
+                result->corrupted++;
+            }
+        }
+        else if ((PHY_DP83825_LoopbackTime(handle) - progress) >= test->timeoutUs)
+        {
+            if (inFlight == 0U)
+            {
+                /* The MAC refuses to send, give up. */
+                result->lost += end - next;
+                break;
+            }
+            /* Nothing came back for too long, the frames in flight are gone. */
+            result->lost += inFlight;
+            inFlight = 0U;
+            live     = next;
+            (void)memset(s_loopbackPending, 0, sizeof(s_loopbackPending));
+            progress = PHY_DP83825_LoopbackTime(handle);
+        }
+    }
+
+    elapsed = PHY_DP83825_LoopbackTime(handle) - start;
+    result->received += received;
+    result->throughputKbps =
+        (elapsed != 0U) ? (uint32_t)(((uint64_t)received * test->frameLength * 8U * 1000U) / elapsed) : 0U;
+}
+
+status_t PHY_DP83825_LoopbackTest(phy_handle_t *handle,
+                                  phy_dp83825_loopback_t loopback,
+                                  phy_speed_t speed,
+                                  const phy_dp83825_loopback_port_t *port,
+                                  const phy_dp83825_loopback_test_t *test,
+                                  phy_dp83825_loopback_result_t *result)
+{
+    assert(port && test && result);
+
+    status_t status;
+    uint32_t length;
+    uint32_t start;
+
+    (void)memset(result, 0, sizeof(*result));
+    result->status = kStatus_InvalidArgument;
+    if ((loopback == kPHY_DP83825_LoopbackNone) || (loopback == kPHY_DP83825_LoopbackReverse) ||
+        (loopback >= kPHY_DP83825_LoopbackCount) || (test->frameLength < PHY_DP83825_LOOPBACK_MIN_FRAME) ||
+        (test->frameLength > PHY_DP83825_LOOPBACK_MAX_FRAME) || (test->window == 0U) ||
+        (test->window > PHY_DP83825_LOOPBACK_MAX_WINDOW) ||
+        (((phy_dp83825_resource_t *)handle->resource)->getTimeUs == NULL))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    status         = PHY_DP83825_SetLoopback(handle, loopback, speed);
+    result->status = status;
+    if (status != kStatus_Success)
+    {
+        return status;
+    }
+    PHY_DP83825_LoopbackDelay(handle, PHY_DP83825_LOOPBACK_SETTLE_US);
+
+    /* Drop whatever the MAC received before, for at most one timeout on a busy segment. */
+    start = PHY_DP83825_LoopbackTime(handle);
+    do
+    {
+        length = sizeof(s_loopbackRx);
+    } while ((port->receive(port->context, s_loopbackRx, &length) == kStatus_Success) &&
+             ((PHY_DP83825_LoopbackTime(handle) - start) < test->timeoutUs));
+
+    PHY_DP83825_LoopbackLatency(handle, port, test, result);
+    PHY_DP83825_LoopbackThroughput(handle, port, test, result);
+
+    return PHY_DP83825_SetLoopback(handle, kPHY_DP83825_LoopbackNone, speed);
+}
+
+status_t PHY_DP83825_LoopbackSweep(phy_handle_t *handle,
+                                   phy_speed_t speed,
+                                   const phy_dp83825_loopback_port_t *port,
+                                   const phy_dp83825_loopback_test_t *test,
+                                   phy_dp83825_loopback_result_t results[kPHY_DP83825_LoopbackCount])
+{
+    /* From the MAC outwards. */
+    static const phy_dp83825_loopback_t order[] = {
+        kPHY_DP83825_LoopbackLocal,   kPHY_DP83825_LoopbackPcsIn,  kPHY_DP83825_LoopbackPcsOut,
+        kPHY_DP83825_LoopbackDigital, kPHY_DP83825_LoopbackAnalog,
+    };
+    status_t status;
+    uint32_t index;
+
+    for (index = 0U; index < (uint32_t)kPHY_DP83825_LoopbackCount; index++)
+    {
+        (void)memset(&results[index], 0, sizeof(results[index]));
+        results[index].status = kStatus_InvalidArgument;
+    }
+    for (index = 0U; index < (sizeof(order) / sizeof(order[0])); index++)
+    {
+        status = PHY_DP83825_LoopbackTest(handle, order[index], speed, port, test, &results[order[index]]);
+        if (status == kStatus_Timeout)
+        {
+            return status;
+        }
+    }
+    return kStatus_Success;
+}
+
+#endif /* PHY_DP83825_ENABLE_LOOPBACK */
@@ -0,0 +1,123 @@
+/*
+ * fsl_phydp83825_loopback.h
+ *
+ *  Loopback datapath qualification for the DP83825 PHY driver.
+ */
+
+#ifndef _FSL_PHYDP83825_LOOPBACK_H_
+#define _FSL_PHYDP83825_LOOPBACK_H_
+
+#include "fsl_phydp83825.h"
+
+/*!
+ * @addtogroup phy_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Largest test frame, without FCS. */
+#define PHY_DP83825_LOOPBACK_MAX_FRAME (1514U)
+
+/*! @brief Smallest test frame, without FCS. */
+#define PHY_DP83825_LOOPBACK_MIN_FRAME (60U)
+
+/*! @brief Largest throughput window, a multiple of 32. Each frame of the window takes one bit. */
+#ifndef PHY_DP83825_LOOPBACK_MAX_WINDOW
+#define PHY_DP83825_LOOPBACK_MAX_WINDOW (32U)
+#endif
+
+/*! @brief MAC access used by the loopback test. */
+typedef struct _phy_dp83825_loopback_port
+{
+    /*! Queues a frame for transmission, kStatus_Busy if the MAC can not take it yet. */
+    status_t (*send)(void *context, const uint8_t *frame, uint32_t length);
+    /*! Gets a received frame, kStatus_Busy if none is pending. Must not block. */
+    status_t (*receive)(void *context, uint8_t *frame, uint32_t *length);
+    void *context; /*!< Passed to the callbacks. */
+} phy_dp83825_loopback_port_t;
+
+/*! @brief Loopback test parameters. */
+typedef struct _phy_dp83825_loopback_test
+{
+    uint32_t frameLength; /*!< Test frame length without FCS. */
+    uint32_t frames;      /*!< Frames of the latency and of the throughput run each. */
+    uint32_t window;      /*!< Frames in flight during the throughput run, at most PHY_DP83825_LOOPBACK_MAX_WINDOW. */
+    uint32_t timeoutUs;   /*!< Time after which a frame counts as lost. */
+} phy_dp83825_loopback_test_t;
+
+/*! @brief Loopback test results of one loopback point. */
+typedef struct _phy_dp83825_loopback_result
+{
+    status_t status;         /*!< Loopback setup status, the results are only valid on success. */
+    uint32_t sent;           /*!< Frames sent. */
+    uint32_t received;       /*!< Frames received intact. */
+    uint32_t corrupted;      /*!< Frames received with a wrong payload. */
+    uint32_t lost;           /*!< Frames not received in time. */
+    uint32_t minLatencyUs;   /*!< Minimum round trip time. */
+    uint32_t avgLatencyUs;   /*!< Average round trip time. */
+    uint32_t maxLatencyUs;   /*!< Maximum round trip time. */
+    uint32_t throughputKbps; /*!< Frame data throughput of the windowed run. */
+} phy_dp83825_loopback_result_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Measures the datapath through one loopback point.
+ *
+ * Selects the loopback with PHY_DP83825_SetLoopback(), measures the round trip latency frame by
+ * frame, then the throughput with a window of frames in flight, and leaves the loopback. The
+ * resource needs a time source. Reverse loopback returns data to the link partner and can not be
+ * measured from the MAC.
+ *
+ * @param handle    PHY device handle.
+ * @param loopback  Loopback point.
+ * @param speed     Loopback speed, see PHY_DP83825_SetLoopback().
+ * @param port      MAC access.
+ * @param test      Test parameters.
+ * @param result    The test results.
+ * @retval kStatus_Success          Test run, see the result for frame errors.
+ * @retval kStatus_InvalidArgument  Loopback point or parameters not supported.
+ * @retval kStatus_Timeout          PHY access timeout.
+ */
+status_t PHY_DP83825_LoopbackTest(phy_handle_t *handle,
+                                  phy_dp83825_loopback_t loopback,
+                                  phy_speed_t speed,
+                                  const phy_dp83825_loopback_port_t *port,
+                                  const phy_dp83825_loopback_test_t *test,
+                                  phy_dp83825_loopback_result_t *result);
+
+/*!
+ * @brief Measures the datapath through every loopback point measurable from the MAC.
+ *
+ * Runs PHY_DP83825_LoopbackTest() from the MAC side outwards: local, PCS input, PCS output,
+ * digital, analog. Comparing the points locates the stage a problem lives in.
+ *
+ * @param handle   PHY device handle.
+ * @param speed    Loopback speed.
+ * @param port     MAC access.
+ * @param test     Test parameters.
+ * @param results  The results, indexed by phy_dp83825_loopback_t, unmeasured points set to kStatus_InvalidArgument.
+ * @retval kStatus_Success  Sweep run, see the results.
+ */
+status_t PHY_DP83825_LoopbackSweep(phy_handle_t *handle,
+                                   phy_speed_t speed,
+                                   const phy_dp83825_loopback_port_t *port,
+                                   const phy_dp83825_loopback_test_t *test,
+                                   phy_dp83825_loopback_result_t results[kPHY_DP83825_LoopbackCount]);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_PHYDP83825_LOOPBACK_H_ */
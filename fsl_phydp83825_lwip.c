@@ -0,0 +1,240 @@
+/*
+ * fsl_phydp83825_lwip.c
+ *
+ *  lwIP netif link management driven by the DP83825 PHY interrupt.
+ */
+
+#include "fsl_phydp83825_lwip.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void PHY_DP83825_NetifProcess(void *context);
+static void PHY_DP83825_NetifFlapTimer(void *context);
+static void PHY_DP83825_NetifRetryTimer(void *context);
+static void PHY_DP83825_NetifEvent(phy_handle_t *handle, phy_dp83825_event_t event, void *userData);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t PHY_DP83825_NetifTimeUs(phy_dp83825_netif_t *glue)
+{
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)glue->phy->resource;
+
+    return (resource->getTimeUs != NULL) ? resource->getTimeUs() : 0U;
+}
+
+static void PHY_DP83825_NetifArmFlapTimer(phy_dp83825_netif_t *glue, uint32_t delayUs)
+{
+    sys_untimeout(PHY_DP83825_NetifFlapTimer, glue);
+    if (delayUs != 0U)
+    {
+        sys_timeout((delayUs + 999U) / 1000U, PHY_DP83825_NetifFlapTimer, glue);
+    }
+}
+
+static void PHY_DP83825_NetifFlapTimer(void *context)
+{
+    phy_dp83825_netif_t *glue = (phy_dp83825_netif_t *)context;
+
+    PHY_DP83825_NetifArmFlapTimer(glue, PHY_DP83825_ProcessFlapTimer(glue->phy));
+}
+
+static void PHY_DP83825_NetifPass(phy_dp83825_netif_t *glue)
+{
+    /* Reading MISR releases INT, the next event gives a new edge. */
+    if (PHY_DP83825_ProcessInterrupt(glue->phy) != kStatus_Success)
+    {
+        glue->stats.errors++;
+    }
+    /* Flap damping may hold the change back, report it once its hold time is over. */
+    PHY_DP83825_NetifArmFlapTimer(glue, PHY_DP83825_ProcessFlapTimer(glue->phy));
+}
+
+static void PHY_DP83825_NetifProcess(void *context)
+{
+    phy_dp83825_netif_t *glue = (phy_dp83825_netif_t *)context;
+
+    /* Interrupts from here on need another pass. */
+    glue->pending = false;
+    if (glue->netif == NULL)
+    {
+        /* Link management stopped while this pass was queued. */
+        tcpip_callbackmsg_delete(glue->msg);
+        glue->msg = NULL;
+        return;
+    }
+    PHY_DP83825_NetifPass(glue);
+}
+
+static void PHY_DP83825_NetifRetryTimer(void *context)
+{
+    phy_dp83825_netif_t *glue = (phy_dp83825_netif_t *)context;
+
+    /*
+     * An interrupt that found the mailbox full left INT asserted, without a pass no further edge
+     * comes. Cleared before the pass, the pass covers every interrupt up to its MISR read.
+     */
+    if (glue->retry)
+    {
+        glue->retry = false;
+        PHY_DP83825_NetifPass(glue);
+    }
+    sys_timeout(PHY_DP83825_NETIF_RETRY_MS, PHY_DP83825_NetifRetryTimer, glue);
+}
+
+static void PHY_DP83825_NetifStart(void *context)
+{
+    phy_dp83825_netif_t *glue = (phy_dp83825_netif_t *)context;
+
+    sys_timeout(PHY_DP83825_NETIF_RETRY_MS, PHY_DP83825_NetifRetryTimer, glue);
+    PHY_DP83825_NetifPass(glue);
+}
+
+static void PHY_DP83825_NetifEvent(phy_handle_t *handle, phy_dp83825_event_t event, void *userData)
+{
+    phy_dp83825_netif_t *glue     = (phy_dp83825_netif_t *)userData;
+    phy_dp83825_netif_link_t link = {0};
+    status_t result               = kStatus_Success;
+    uint32_t latencyUs;
+
+    if ((event == kPHY_DP83825_EventLinkUp) || (event == kPHY_DP83825_EventLinkDown))
+    {
+        link.up = (event == kPHY_DP83825_EventLinkUp);
+        if (link.up)
+        {
+            result = PHY_DP83825_GetLinkSpeedDuplex(handle, &link.speed, &link.duplex);
+            if ((result == kStatus_Success) && (link.duplex == kPHY_FullDuplex))
+            {
+                result = PHY_DP83825_GetLinkPause(handle, &link.rxPause, &link.txPause);
+            }
+        }
+
+        /* The MAC has to match the link before the stack sends on it. */
+        if (result == kStatus_Success)
+        {
+            if (glue->macConfig != NULL)
+            {
+                glue->macConfig(glue->macContext, &link);
+            }
+            if (link.up)
+            {
+                netif_set_link_up(glue->netif);
+            }
+            else
+            {
+                netif_set_link_down(glue->netif);
+            }
+
+            latencyUs                 = PHY_DP83825_NetifTimeUs(glue) - glue->interruptUs;
+            glue->stats.lastLatencyUs = latencyUs;
+            if (latencyUs > glue->stats.maxLatencyUs)
+            {
+                glue->stats.maxLatencyUs = latencyUs;
+            }
+            glue->stats.linkChanges++;
+        }
+        else
+        {
+            glue->stats.errors++;
+        }
+    }
+
+    if (glue->chainCallback != NULL)
+    {
+        glue->chainCallback(handle, event, glue->chainUserData);
+    }
+}
+
+status_t PHY_DP83825_NetifInit(phy_dp83825_netif_t *glue,
+                               struct netif *netif,
+                               phy_handle_t *phy,
+                               phy_dp83825_netif_mac_config_t macConfig,
+                               void *macContext)
+{
+    assert(glue);
+    assert(netif);
+    assert(phy);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)phy->resource;
+
+    (void)memset(glue, 0, sizeof(*glue));
+    glue->netif      = netif;
+    glue->phy        = phy;
+    glue->macConfig  = macConfig;
+    glue->macContext = macContext;
+
+    /* Allocated once, the interrupt handler cannot allocate. */
+    glue->msg = tcpip_callbackmsg_new(PHY_DP83825_NetifProcess, glue);
+    if (glue->msg == NULL)
+    {
+        return kStatus_Fail;
+    }
+
+    glue->chainCallback     = resource->eventCallback;
+    glue->chainUserData     = resource->eventUserData;
+    resource->eventUserData = glue;
+    resource->eventCallback = PHY_DP83825_NetifEvent;
+
+    /* Pick up a link that came up before the glue was there, and start the retry timer. */
+    glue->interruptUs = PHY_DP83825_NetifTimeUs(glue);
+    if (tcpip_callback(PHY_DP83825_NetifStart, glue) != ERR_OK)
+    {
+        resource->eventCallback = glue->chainCallback;
+        resource->eventUserData = glue->chainUserData;
+        tcpip_callbackmsg_delete(glue->msg);
+        glue->msg = NULL;
+        return kStatus_Fail;
+    }
+    return kStatus_Success;
+}
+
+void PHY_DP83825_NetifDeinit(phy_dp83825_netif_t *glue)
+{
+    assert(glue);
+
+    phy_dp83825_resource_t *resource = (phy_dp83825_resource_t *)glue->phy->resource;
+
+    resource->eventCallback = glue->chainCallback;
+    resource->eventUserData = glue->chainUserData;
+    sys_untimeout(PHY_DP83825_NetifFlapTimer, glue);
+    sys_untimeout(PHY_DP83825_NetifRetryTimer, glue);
+
+    /* A queued message can only be freed by the pass that takes it. */
+    glue->netif = NULL;
+    if (!glue->pending)
+    {
+        tcpip_callbackmsg_delete(glue->msg);
+        glue->msg = NULL;
+    }
+}
+
+void PHY_DP83825_NetifIRQHandler(phy_dp83825_netif_t *glue)
+{
+    glue->stats.interrupts++;
+    if (glue->pending || (glue->netif == NULL))
+    {
+        /* The queued pass reads the link state after this interrupt. */
+        return;
+    }
+
+    glue->interruptUs = PHY_DP83825_NetifTimeUs(glue);
+    glue->pending     = true;
+    if (tcpip_callbackmsg_trycallback_fromisr(glue->msg) != ERR_OK)
+    {
+        /* MISR stays unread, the retry timer runs the pass instead. */
+        glue->pending = false;
+        glue->retry   = true;
+        glue->stats.dropped++;
+    }
+}
+
+void PHY_DP83825_NetifGetStats(phy_dp83825_netif_t *glue, phy_dp83825_netif_stats_t *stats)
+{
+    assert(glue);
+    assert(stats);
+
+    *stats = glue->stats;
+}
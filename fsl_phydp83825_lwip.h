@@ -0,0 +1,144 @@
+/*
+ * fsl_phydp83825_lwip.h
+ *
+ *  lwIP netif link management driven by the DP83825 PHY interrupt.
+ */
+
+#ifndef _FSL_PHYDP83825_LWIP_H_
+#define _FSL_PHYDP83825_LWIP_H_
+
+#include "fsl_phydp83825.h"
+#include "lwip/netif.h"
+#include "lwip/tcpip.h"
+#include "lwip/timeouts.h"
+
+/*!
+ * @addtogroup phy_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Period of the tcpip thread check for interrupts that could not be queued, in ms. */
+#ifndef PHY_DP83825_NETIF_RETRY_MS
+#define PHY_DP83825_NETIF_RETRY_MS (20U)
+#endif
+
+/*! @brief Resolved link parameters handed to the MAC. */
+typedef struct _phy_dp83825_netif_link
+{
+    bool up;             /*!< Link state, the other members are only valid with the link up. */
+    phy_speed_t speed;   /*!< Link speed. */
+    phy_duplex_t duplex; /*!< Link duplex. */
+    bool rxPause;        /*!< Act on received pause frames. */
+    bool txPause;        /*!< Send pause frames. */
+} phy_dp83825_netif_link_t;
+
+/*!
+ * @brief MAC configuration callback.
+ *
+ * Called from the tcpip thread before the netif learns about a link change, e.g. to call
+ * ENET_SetMII() and program the pause frame handling.
+ */
+typedef void (*phy_dp83825_netif_mac_config_t)(void *context, const phy_dp83825_netif_link_t *link);
+
+/*! @brief Link management statistics. */
+typedef struct _phy_dp83825_netif_stats
+{
+    uint32_t interrupts;    /*!< PHY interrupts taken. */
+    uint32_t dropped;       /*!< Interrupts not queued to the tcpip thread, its mailbox was full. */
+    uint32_t linkChanges;   /*!< Link changes passed to the netif. */
+    uint32_t errors;        /*!< PHY accesses failed while handling an interrupt. */
+    uint32_t lastLatencyUs; /*!< Interrupt to netif update of the last link change. */
+    uint32_t maxLatencyUs;  /*!< Longest interrupt to netif update. */
+} phy_dp83825_netif_stats_t;
+
+/*! @brief Link management state of one netif, owned by the glue once initialized. */
+typedef struct _phy_dp83825_netif
+{
+    struct netif *netif;                        /*!< Managed netif. */
+    phy_handle_t *phy;                          /*!< PHY of the netif. */
+    phy_dp83825_netif_mac_config_t macConfig;   /*!< MAC configuration callback. */
+    void *macContext;                           /*!< Passed to macConfig. */
+    struct tcpip_callback_msg *msg;             /*!< Preallocated tcpip thread message. */
+    volatile bool pending;                      /*!< msg is queued to the tcpip thread. */
+    volatile bool retry;                        /*!< An interrupt found the mailbox full, see NETIF_RETRY_MS. */
+    volatile uint32_t interruptUs;              /*!< Time of the interrupt being handled. */
+    phy_dp83825_event_callback_t chainCallback; /*!< Event callback installed before the glue. */
+    void *chainUserData;                        /*!< Passed to chainCallback. */
+    phy_dp83825_netif_stats_t stats;            /*!< Statistics. */
+} phy_dp83825_netif_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Starts interrupt driven link management of a netif.
+ *
+ * Takes over the event callback of the PHY resource, an event callback installed before is still
+ * called for every event. The PHY must be initialized with the link interrupt enabled. The current
+ * link state is picked up right away, from the tcpip thread. With link flap damping configured the
+ * damping timers run as lwIP timeouts. Call it from a thread, it waits for room in the tcpip
+ * mailbox.
+ *
+ * @param glue        Link management state, must stay valid while the netif is managed.
+ * @param netif       The netif.
+ * @param phy         PHY device handle of the netif.
+ * @param macConfig   MAC configuration callback.
+ * @param macContext  Passed to macConfig.
+ * @retval kStatus_Success  Link management started.
+ * @retval kStatus_Fail     No memory for the tcpip thread messages.
+ */
+status_t PHY_DP83825_NetifInit(phy_dp83825_netif_t *glue,
+                               struct netif *netif,
+                               phy_handle_t *phy,
+                               phy_dp83825_netif_mac_config_t macConfig,
+                               void *macContext);
+
+/*!
+ * @brief Stops link management of a netif and restores the event callback.
+ *
+ * Call it from the tcpip thread. The state must stay valid until the tcpip thread handled the
+ * messages queued before.
+ *
+ * @param glue  Link management state.
+ */
+void PHY_DP83825_NetifDeinit(phy_dp83825_netif_t *glue);
+
+/*!
+ * @brief PHY interrupt handler.
+ *
+ * Call it from the INT pin interrupt. It only timestamps the interrupt and hands it to the tcpip
+ * thread, all PHY accesses are done there.
+ *
+ * The INT pin interrupt must be edge triggered, on the falling edge of the active low pin. INT
+ * stays asserted until the tcpip thread reads the interrupt status, a level triggered interrupt
+ * would fire again right away. When the tcpip mailbox is full, the interrupt is counted as dropped
+ * and handled by a timer within PHY_DP83825_NETIF_RETRY_MS, as no new edge comes before.
+ *
+ * @param glue  Link management state.
+ */
+void PHY_DP83825_NetifIRQHandler(phy_dp83825_netif_t *glue);
+
+/*!
+ * @brief Gets the link management statistics.
+ *
+ * @param glue   Link management state.
+ * @param stats  The statistics.
+ */
+void PHY_DP83825_NetifGetStats(phy_dp83825_netif_t *glue, phy_dp83825_netif_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_PHYDP83825_LWIP_H_ */
@@ -0,0 +1,163 @@
+/*
+ * fsl_phydp83825_pool.c
+ *
+ *  Statically allocated DP83825 PHY instances, on one or more MDIO buses.
+ */
+
+#include "fsl_phydp83825_pool.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void PHY_DP83825_PoolEvent(phy_handle_t *handle, phy_dp83825_event_t event, void *userData);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static phy_dp83825_instance_t s_pool[PHY_DP83825_POOL_SIZE];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void PHY_DP83825_PoolEvent(phy_handle_t *handle, phy_dp83825_event_t event, void *userData)
+{
+    phy_dp83825_instance_t *instance = (phy_dp83825_instance_t *)userData;
+    phy_dp83825_pool_link_t *link    = &instance->link;
+
+    if ((event == kPHY_DP83825_EventLinkUp) || (event == kPHY_DP83825_EventLinkDown))
+    {
+        link->up = (event == kPHY_DP83825_EventLinkUp);
+        if (link->up && (PHY_DP83825_GetLinkSpeedDuplex(handle, &link->speed, &link->duplex) != kStatus_Success))
+        {
+            link->errors++;
+        }
+        link->changes++;
+    }
+
+    if (instance->eventCallback != NULL)
+    {
+        instance->eventCallback(handle, event, instance->eventUserData);
+    }
+}
+
+status_t PHY_DP83825_PoolOpen(const phy_dp83825_bus_t *bus,
+                              const phy_config_t *config,
+                              phy_dp83825_instance_t **instance)
+{
+    assert(bus);
+    assert(config);
+    assert(instance);
+
+    phy_dp83825_instance_t *slot = NULL;
+    phy_config_t busConfig       = *config;
+    status_t result;
+    uint32_t index;
+
+    *instance = NULL;
+    if (PHY_DP83825_PoolFind(bus->busId, config->phyAddr) != NULL)
+    {
+        return kStatus_InvalidArgument;
+    }
+    for (index = 0U; index < PHY_DP83825_POOL_SIZE; index++)
+    {
+        if (!s_pool[index].used)
+        {
+            slot = &s_pool[index];
+            break;
+        }
+    }
+    if (slot == NULL)
+    {
+        return kStatus_Fail;
+    }
+
+    (void)memset(slot, 0, sizeof(*slot));
+    if (config->resource != NULL)
+    {
+        slot->resource = *(const phy_dp83825_resource_t *)config->resource;
+    }
+    slot->eventCallback          = slot->resource.eventCallback;
+    slot->eventUserData          = slot->resource.eventUserData;
+    slot->resource.eventCallback = PHY_DP83825_PoolEvent;
+    slot->resource.eventUserData = slot;
+    slot->resource.bus           = bus;
+    slot->busId                  = bus->busId;
+    slot->used                   = true;
+
+    busConfig.resource = &slot->resource;
+    result             = PHY_DP83825_Init(&slot->handle, &busConfig);
+    if (result != kStatus_Success)
+    {
+        slot->used = false;
+        return result;
+    }
+    *instance = slot;
+    return result;
+}
+
+void PHY_DP83825_PoolClose(phy_dp83825_instance_t *instance)
+{
+    assert(instance);
+
+    instance->used = false;
+}
+
+phy_dp83825_instance_t *PHY_DP83825_PoolFind(uint8_t busId, uint8_t phyAddr)
+{
+    uint32_t index;
+
+    for (index = 0U; index < PHY_DP83825_POOL_SIZE; index++)
+    {
+        if (s_pool[index].used && (s_pool[index].busId == busId) && (s_pool[index].handle.phyAddr == phyAddr))
+        {
+            return &s_pool[index];
+        }
+    }
+    return NULL;
+}
+
+phy_dp83825_instance_t *PHY_DP83825_PoolFromHandle(phy_handle_t *handle)
+{
+    uint32_t index;
+
+    for (index = 0U; index < PHY_DP83825_POOL_SIZE; index++)
+    {
+        if (&s_pool[index].handle == handle)
+        {
+            return s_pool[index].used ? &s_pool[index] : NULL;
+        }
+    }
+    return NULL;
+}
+
+status_t PHY_DP83825_PoolProcessBus(uint8_t busId)
+{
+    status_t first = kStatus_Success;
+    status_t result;
+    uint32_t index;
+
+    for (index = 0U; index < PHY_DP83825_POOL_SIZE; index++)
+    {
+        if (!s_pool[index].used || (s_pool[index].busId != busId))
+        {
+            continue;
+        }
+        result = PHY_DP83825_ProcessInterrupt(&s_pool[index].handle);
+        if ((result != kStatus_Success) && (first == kStatus_Success))
+        {
+            first = result;
+        }
+    }
+    return first;
+}
+
+void PHY_DP83825_PoolGetLink(phy_dp83825_instance_t *instance, phy_dp83825_pool_link_t *link)
+{
+    assert(instance);
+    assert(link);
+
+    *link = instance->link;
+}
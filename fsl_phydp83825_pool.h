@@ -0,0 +1,131 @@
+/*
+ * fsl_phydp83825_pool.h
+ *
+ *  Statically allocated DP83825 PHY instances, on one or more MDIO buses.
+ */
+
+#ifndef _FSL_PHYDP83825_POOL_H_
+#define _FSL_PHYDP83825_POOL_H_
+
+#include "fsl_phydp83825.h"
+
+/*!
+ * @addtogroup phy_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Defines the number of PHY instances of the pool. */
+#ifndef PHY_DP83825_POOL_SIZE
+#define PHY_DP83825_POOL_SIZE (4U)
+#endif
+
+/*! @brief Link state cached from the driver events. */
+typedef struct _phy_dp83825_pool_link
+{
+    bool up;             /*!< Link state, speed and duplex are only valid with the link up. */
+    phy_speed_t speed;   /*!< Link speed. */
+    phy_duplex_t duplex; /*!< Link duplex. */
+    uint32_t changes;    /*!< Link changes reported. */
+    uint32_t errors;     /*!< Speed and duplex reads failed on link up, the values are stale. */
+} phy_dp83825_pool_link_t;
+
+/*! @brief PHY instance of the pool, all its state stays in the instance. */
+typedef struct _phy_dp83825_instance
+{
+    phy_handle_t handle;                        /*!< Driver handle, bound to resource. */
+    phy_dp83825_resource_t resource;            /*!< Driver state and the bus of the PHY. */
+    uint8_t busId;                              /*!< Bus the PHY is on. */
+    bool used;                                  /*!< Taken by PHY_DP83825_PoolOpen(). */
+    phy_dp83825_pool_link_t link;               /*!< Link state as last reported by the driver. */
+    phy_dp83825_event_callback_t eventCallback; /*!< Event callback of the application. */
+    void *eventUserData;                        /*!< Passed to eventCallback. */
+} phy_dp83825_instance_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Takes an instance of the pool and initializes its PHY.
+ *
+ * The resource of the instance runs on the given bus, the bus functions get the context of the bus
+ * so each MAC drives its own PHYs. config->resource is optional, it is copied as the initial
+ * resource, e.g. with the time source, the delay and the event callback filled in. The event
+ * callback is still called for every event, with the instance keeping the link state up to date.
+ *
+ * The pool itself is not locked, open and close the instances from one task. Instances on different
+ * buses can be used from different tasks, instances on one bus need the bus lock to do the same.
+ *
+ * @param bus       MDIO bus of the PHY, must stay valid while the instance is open.
+ * @param config    PHY configuration, phyAddr selects the PHY on the bus.
+ * @param instance  The instance, NULL if the PHY could not be initialized.
+ * @retval kStatus_Success          PHY initialized.
+ * @retval kStatus_InvalidArgument  The PHY is already open.
+ * @retval kStatus_Fail             No instance left, or the PHY initialization failed.
+ * @retval kStatus_Timeout          PHY access timeout.
+ */
+status_t PHY_DP83825_PoolOpen(const phy_dp83825_bus_t *bus,
+                              const phy_config_t *config,
+                              phy_dp83825_instance_t **instance);
+
+/*!
+ * @brief Returns an instance to the pool.
+ *
+ * The PHY is left as it is.
+ *
+ * @param instance  The instance.
+ */
+void PHY_DP83825_PoolClose(phy_dp83825_instance_t *instance);
+
+/*!
+ * @brief Looks an open instance up.
+ *
+ * @param busId    Bus number, see phy_dp83825_bus_t.
+ * @param phyAddr  PHY address on the bus.
+ * @return The instance, NULL if the PHY is not open.
+ */
+phy_dp83825_instance_t *PHY_DP83825_PoolFind(uint8_t busId, uint8_t phyAddr);
+
+/*!
+ * @brief Gets the instance of a handle.
+ *
+ * @param handle  PHY device handle.
+ * @return The instance, NULL if the handle is not part of the pool.
+ */
+phy_dp83825_instance_t *PHY_DP83825_PoolFromHandle(phy_handle_t *handle);
+
+/*!
+ * @brief Handles the interrupts of all PHYs on a bus.
+ *
+ * Calls PHY_DP83825_ProcessInterrupt() for every open instance on the bus, from the task of the bus.
+ * A failing PHY does not keep the others from being handled.
+ *
+ * @param busId  Bus number.
+ * @retval kStatus_Success  All PHYs handled.
+ * @return The first error of a PHY on the bus.
+ */
+status_t PHY_DP83825_PoolProcessBus(uint8_t busId);
+
+/*!
+ * @brief Gets the cached link state of an instance, without an MDIO access.
+ *
+ * @param instance  The instance.
+ * @param link      The link state.
+ */
+void PHY_DP83825_PoolGetLink(phy_dp83825_instance_t *instance, phy_dp83825_pool_link_t *link);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_PHYDP83825_POOL_H_ */
@@ -0,0 +1,314 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0
+ * Register map of the Texas Instruments DP83822, DP83825 and DP83826 PHYs.
+ *
+ * Copyright (C) 2017 Texas Instruments Inc.
+ */
+
+#ifndef _FSL_PHYDP83825_REGS_H_
+#define _FSL_PHYDP83825_REGS_H_
+
+#include "fsl_phydp83825.h"
+
+#include "bits.h"
+#include "regfield.h"
+
+#define DP83822_PHY_ID	    0x2000a240
+#define DP83825S_PHY_ID		0x2000a140
+#define DP83825I_PHY_ID		0x2000a150
+#define DP83825CM_PHY_ID	0x2000a160
+#define DP83825CS_PHY_ID	0x2000a170
+#define DP83826C_PHY_ID		0x2000a130
+#define DP83826NC_PHY_ID	0x2000a110
+
+#define DP83822_DEVADDR		0x1f
+
+#define MII_DP83822_CTRL_2	0x0a
+#define MII_DP83822_REGCR	0x0d
+#define MII_DP83822_ADDAR	0x0e
+#define MII_DP83822_PHYSTS	0x10
+#define MII_DP83822_PHYSCR	0x11
+#define MII_DP83822_MISR1	0x12
+#define MII_DP83822_MISR2	0x13
+#define MII_DP83822_FCSCR	0x14
+#define MII_DP83822_RECR	0x15
+#define MII_DP83822_BISCR   0x16
+#define MII_DP83822_RCSR	0x17
+#define MII_DP83822_PHYCR   0x19 /* Auto_MDI/X_Enable etc */
+#define MII_DP83822_BICSR1	0x1b
+#define MII_DP83822_BICSR2	0x1c
+#define MII_DP83822_EDCR	0x1d
+#define MII_DP83822_CDCR	0x1e
+#define MII_DP83822_RESET_CTRL	0x1f
+#define MII_DP83822_GENCFG	0x465
+#define MII_DP83822_SOR1	0x467
+
+/* Cable diagnostic results, TX pair peaks 0-4 then RX pair peaks 0-4 */
+#define MII_DP83822_CDLRR1	0x180 /* Peak locations, two per register */
+#define MII_DP83822_CDLAR1	0x185 /* Peak amplitudes, two per register */
+#define MII_DP83822_CDLAR6	0x18a /* Peak signs */
+
+/* EEE registers, IEEE 802.3 clause 45 MMDs */
+#define DP83822_MMD_PCS			3
+#define DP83822_MMD_AN			7
+#define MII_DP83822_PCS_STAT1	0x01 /* MMD 3 */
+#define MII_DP83822_EEE_WAKE_ERR	0x16 /* MMD 3 */
+#define MII_DP83822_EEE_ADV		0x3c /* MMD 7 */
+#define MII_DP83822_EEE_LPABLE	0x3d /* MMD 7 */
+
+/* EEE_ADV & EEE_LPABLE bits */
+#define DP83822_EEE_100TX		BIT(1)
+
+/* PCS_STAT1 bits */
+#define DP83822_PCS_STAT1_RX_LPI_IND	BIT(8)
+#define DP83822_PCS_STAT1_TX_LPI_IND	BIT(9)
+#define DP83822_PCS_STAT1_RX_LPI_RCVD	BIT(10)
+#define DP83822_PCS_STAT1_TX_LPI_RCVD	BIT(11)
+
+/* 100BASE-TX wake time, IEEE 802.3 table 78-4 */
+#define DP83822_EEE_WAKE_100TX_US	30
+
+/* DP83826 specific registers */
+#define MII_DP83826_VOD_CFG1	0x30b
+#define MII_DP83826_VOD_CFG2	0x30c
+
+/* GENCFG */
+#define DP83822_SIG_DET_LOW	BIT(0)
+
+/* Control Register 2 bits */
+#define DP83822_FX_ENABLE	BIT(14)
+
+#define DP83822_HW_RESET	BIT(15)
+#define DP83822_SW_RESET	BIT(14)
+
+/* BMCR bits */
+#define DP83822_BMCR_POWER_DOWN	BIT(11)
+
+/* REGCR fields, ADDAR holds the address or the data depending on the function */
+#define DP83822_REGCR_DATA_INC	BIT(15) /* Data, address incremented after each access */
+#define DP83822_REGCR_DEVAD_MASK	GENMASK(4, 0)
+
+/* PHY STS bits */
+#define DP83822_PHYSTS_SIGNAL_DETECT	BIT(10)
+#define DP83822_PHYSTS_DUPLEX		BIT(2)
+#define DP83822_PHYSTS_10			BIT(1)
+#define DP83822_PHYSTS_LINK			BIT(0)
+
+/* EDCR bits */
+#define DP83822_EDCR_ED_EN			BIT(15)
+#define DP83822_EDCR_ED_AUTO_UP		BIT(14)
+#define DP83822_EDCR_ED_AUTO_DOWN	BIT(13)
+#define DP83822_EDCR_ED_PWR_STATE	BIT(10) /* Set while the front end is powered up */
+
+/* ANAR & ANLPAR pause bits */
+#define DP83822_AN_PAUSE	BIT(10)
+#define DP83822_AN_ASYM_PAUSE	BIT(11)
+
+/* ANER bits */
+#define DP83822_ANER_LP_AN_ABLE	BIT(0) /* Clear after parallel detection */
+#define DP83822_ANER_PDF	BIT(4) /* Parallel detection fault, latched */
+
+/* FCSCR fields, the counters clear on read */
+#define DP83822_FCSCR_FCSCNT_MASK	GENMASK(7, 0)
+
+/* CDCR bits */
+#define DP83822_CDCR_START	BIT(15)
+#define DP83822_CDCR_DONE	BIT(1)
+#define DP83822_CDCR_FAIL	BIT(0)
+
+/* CDLRR & CDLAR fields */
+#define DP83822_CDLRR_LOCATION_MASK	GENMASK(7, 0) /* TDR sample, 0 when no peak */
+#define DP83822_CDLAR_AMPLITUDE_MASK	GENMASK(6, 0)
+#define DP83822_CDLAR6_SIGN_MASK	GENMASK(9, 0) /* Set for a positive peak */
+#define DP83822_TDR_PEAKS		5 /* Per pair */
+
+/* PHYSCR Register Fields */
+#define DP83822_PHYSCR_INT_OE		BIT(0) /* Interrupt Output Enable */
+#define DP83822_PHYSCR_INTEN		BIT(1) /* Interrupt Enable */
+
+/* MISR1 bits */
+#define DP83822_RX_ERR_HF_INT_EN		BIT(0)
+#define DP83822_FALSE_CARRIER_HF_INT_EN	BIT(1)
+#define DP83822_ANEG_COMPLETE_INT_EN	BIT(2)
+#define DP83822_DUP_MODE_CHANGE_INT_EN	BIT(3)
+#define DP83822_SPEED_CHANGED_INT_EN	BIT(4)
+#define DP83822_LINK_STAT_INT_EN		BIT(5)
+#define DP83822_ENERGY_DET_INT_EN		BIT(6)
+#define DP83822_LINK_QUAL_INT_EN		BIT(7)
+
+#define DP83822_ENERGY_DET_INT		BIT(14)
+
+/* MISR2 bits */
+#define DP83822_JABBER_DET_INT_EN	BIT(0)
+#define DP83822_WOL_PKT_INT_EN		BIT(1)
+#define DP83822_SLEEP_MODE_INT_EN	BIT(2)
+#define DP83822_MDI_XOVER_INT_EN	BIT(3)
+#define DP83822_LB_FIFO_INT_EN		BIT(4)
+#define DP83822_PAGE_RX_INT_EN		BIT(5)
+#define DP83822_ANEG_ERR_INT_EN		BIT(6)
+#define DP83822_EEE_ERROR_CHANGE_INT_EN	BIT(7)
+#define DP83822_WOL_PKT_INT		BIT(9)
+#define DP83822_EEE_ERROR_CHANGE_INT	BIT(15)
+
+/* INT_STAT1 bits */
+#define DP83822_WOL_INT_EN	BIT(4)
+#define DP83822_WOL_INT_STAT	BIT(12)
+
+#define MII_DP83822_RXSOP1	0x04a5
+#define	MII_DP83822_RXSOP2	0x04a6
+#define	MII_DP83822_RXSOP3	0x04a7
+
+/* WoL Registers */
+#define	MII_DP83822_WOL_CFG		0x04a0
+#define	MII_DP83822_WOL_STAT	0x04a1
+#define	MII_DP83822_WOL_DA1		0x04a2
+#define	MII_DP83822_WOL_DA2		0x04a3
+#define	MII_DP83822_WOL_DA3		0x04a4
+
+/* WoL bits */
+#define DP83822_WOL_MAGIC_EN	BIT(0)
+#define DP83822_WOL_SECURE_ON	BIT(5)
+#define DP83822_WOL_EN		BIT(7)
+#define DP83822_WOL_INDICATION_SEL BIT(8)
+#define DP83822_WOL_CLR_INDICATION BIT(11)
+
+/* PHYCR bits */
+#define DP83822_MDIX_AUTO_EN     BIT(15)
+#define DP83822_MDIX_FORCE_CROSS BIT(14)
+
+/* RCSR bits */
+/* 2 bit tolerance < 2400 byte packets (50ppm) */
+#define DP83822_ELASTICBUF_2B   0x1
+/* 6 bit tolerance < 7200 byte packets */
+#define DP83822_ELASTICBUF_6B   0x2
+/* 10 bit tolerance < 12000 byte packets */
+#define DP83822_ELASTICBUF_10B  0x3
+/* 14 bit tolerance < 16800 byte packets */
+#define DP83822_ELASTICBUF_14B  0x0
+#define DP83822_ELASTICBUF_MASK GENMASK(1, 0)
+#define DP83822_RX_UNF_STS	BIT(2)
+#define DP83822_RX_OVF_STS	BIT(3)
+#define DP83822_RMII_MODE_EN	BIT(5)
+#define DP83822_RMII_MODE_SEL	BIT(7)
+#define DP83822_RGMII_MODE_EN	BIT(9)
+#define DP83822_RX_CLK_SHIFT	BIT(12)
+#define DP83822_TX_CLK_SHIFT	BIT(11)
+
+/* SOR1 mode */
+#define DP83822_STRAP_MODE1	0
+#define DP83822_STRAP_MODE2	BIT(0)
+#define DP83822_STRAP_MODE3	BIT(1)
+#define DP83822_STRAP_MODE4	GENMASK(1, 0)
+
+#define DP83822_COL_STRAP_MASK	GENMASK(11, 10)
+#define DP83822_COL_SHIFT	10
+#define DP83822_RX_ER_STR_MASK	GENMASK(9, 8)
+#define DP83822_RX_ER_SHIFT	8
+
+/* DP83826: VOD_CFG1 & VOD_CFG2 */
+#define DP83826_VOD_CFG1_MINUS_MDIX_MASK	GENMASK(13, 12)
+#define DP83826_VOD_CFG1_MINUS_MDI_MASK		GENMASK(11, 6)
+#define DP83826_VOD_CFG2_MINUS_MDIX_MASK	GENMASK(15, 12)
+#define DP83826_VOD_CFG2_PLUS_MDIX_MASK		GENMASK(11, 6)
+#define DP83826_VOD_CFG2_PLUS_MDI_MASK		GENMASK(5, 0)
+#define DP83826_CFG_DAC_MINUS_MDIX_5_TO_4	GENMASK(5, 4)
+#define DP83826_CFG_DAC_MINUS_MDIX_3_TO_0	GENMASK(3, 0)
+#define DP83826_CFG_DAC_PERCENT_PER_STEP	625
+#define DP83826_CFG_DAC_PERCENT_DEFAULT		10000
+#define DP83826_CFG_DAC_MINUS_DEFAULT		0x30
+#define DP83826_CFG_DAC_PLUS_DEFAULT		0x10
+
+/* BISCR bits */
+#define DP83822_BISCR_LOOPBACKMODE_MASK    GENMASK(4,0)
+#define DP83822_LOOPBACKMODE_PCSIN         BIT(0)
+#define DP83822_LOOPBACKMODE_PCSOUT        BIT(1)
+#define DP83822_LOOPBACKMODE_DIGITAL       BIT(2)
+#define DP83822_LOOPBACKMODE_ANALOG        BIT(3)
+#define DP83822_LOOPBACKMODE_REVERSE       BIT(4)
+#define DP83822_BISCR_PKT_GEN_BUSY         BIT(9)  /* RO */
+#define DP83822_BISCR_PRBS_LOCK            BIT(10) /* RO */
+#define DP83822_BISCR_PRBS_SYNC_LOSS       BIT(11) /* RO, latched */
+#define DP83822_BISCR_PKT_GEN_EN           BIT(12)
+#define DP83822_BISCR_PKT_GEN_64BIT        BIT(13)
+#define DP83822_BISCR_ERR_CNT_MODE         BIT(14) /* 0: stop at 0xFF, 1: wrap */
+
+/* BICSR1 & BICSR2 fields */
+#define DP83822_BICSR1_ERR_COUNT_MASK      GENMASK(15, 8) /* Cleared on read */
+#define DP83822_BICSR1_IPG_MASK            GENMASK(7, 0)
+#define DP83822_BICSR2_PKT_LENGTH_MASK     GENMASK(10, 0)
+
+/* 100BASE-FX has a single ability, auto-negotiation is not used on fiber */
+#define MII_DP83822_FIBER_ADVERTISE    (PHY_100BASETX_FULLDUPLEX_MASK | \
+					DP83822_AN_PAUSE | DP83822_AN_ASYM_PAUSE | \
+					PHY_IEEE802_3_SELECTOR_MASK)
+
+#if defined(__cplusplus)
+/*! @brief Typed register and field descriptors, see regfield.h. */
+namespace dp83825
+{
+using BMCR     = regfield::Reg<PHY_BASICCONTROL_REG>;
+using ANAR     = regfield::Reg<PHY_AUTONEG_ADVERTISE_REG>;
+using PHYSCR   = regfield::Reg<MII_DP83822_PHYSCR>;
+using MISR1    = regfield::Reg<MII_DP83822_MISR1>;
+using MISR2    = regfield::Reg<MII_DP83822_MISR2>;
+using BISCR    = regfield::Reg<MII_DP83822_BISCR>;
+using RCSR     = regfield::Reg<MII_DP83822_RCSR>;
+using PHYCR    = regfield::Reg<MII_DP83822_PHYCR>;
+using BICSR1   = regfield::Reg<MII_DP83822_BICSR1>;
+using BICSR2   = regfield::Reg<MII_DP83822_BICSR2>;
+using WOL_CFG  = regfield::Reg<MII_DP83822_WOL_CFG, DP83822_DEVADDR>;
+using VOD_CFG1 = regfield::Reg<MII_DP83826_VOD_CFG1, DP83822_DEVADDR>;
+using VOD_CFG2 = regfield::Reg<MII_DP83826_VOD_CFG2, DP83822_DEVADDR>;
+
+using BMCR_DUPLEX      = regfield::Field<BMCR, 8, 8>;
+using BMCR_ISOLATE     = regfield::Field<BMCR, 10, 10>;
+using BMCR_AUTONEG     = regfield::Field<BMCR, 12, 12>;
+using BMCR_SPEED       = regfield::Field<BMCR, 13, 13>;
+using BMCR_LOOPBACK    = regfield::Field<BMCR, 14, 14>;
+using ANAR_PAUSE       = regfield::Field<ANAR, 10, 10>;
+using ANAR_ASYM_PAUSE  = regfield::Field<ANAR, 11, 11>;
+using PHYSCR_INT_OE    = regfield::Field<PHYSCR, 0, 0>;
+using PHYSCR_INTEN     = regfield::Field<PHYSCR, 1, 1>;
+using BISCR_LOOPBACK   = regfield::Field<BISCR, 4, 0>;
+using BISCR_PKT_GEN_EN = regfield::Field<BISCR, 12, 12>;
+using BICSR1_IPG       = regfield::Field<BICSR1, 7, 0>;
+using BICSR1_ERR_COUNT = regfield::Field<BICSR1, 15, 8>;
+using BICSR2_PKT_LEN   = regfield::Field<BICSR2, 10, 0>;
+using RCSR_ELASTBUF    = regfield::Field<RCSR, 1, 0>;
+using RCSR_RMII_SEL    = regfield::Field<RCSR, 7, 7>;
+using PHYCR_MDIX_EN    = regfield::Field<PHYCR, 15, 15>;
+using PHYCR_FORCE_MDIX = regfield::Field<PHYCR, 14, 14>;
+using WOL_MAGIC_EN     = regfield::Field<WOL_CFG, 0, 0>;
+using WOL_SECURE_ON    = regfield::Field<WOL_CFG, 5, 5>;
+using WOL_EN           = regfield::Field<WOL_CFG, 7, 7>;
+
+using VOD_CFG1_MINUS_MDIX = regfield::Field<VOD_CFG1, 13, 12>;
+using VOD_CFG1_MINUS_MDI  = regfield::Field<VOD_CFG1, 11, 6>;
+using VOD_CFG2_MINUS_MDIX = regfield::Field<VOD_CFG2, 15, 12>;
+using VOD_CFG2_PLUS_MDIX  = regfield::Field<VOD_CFG2, 11, 6>;
+using VOD_CFG2_PLUS_MDI   = regfield::Field<VOD_CFG2, 5, 0>;
+
+/* The typed fields must describe the same bits as the C masks. */
+static_assert(BISCR_LOOPBACK::mask == DP83822_BISCR_LOOPBACKMODE_MASK, "BISCR loopback field mismatch");
+static_assert(BICSR1_ERR_COUNT::mask == DP83822_BICSR1_ERR_COUNT_MASK, "BICSR1 field mismatch");
+static_assert(BICSR2_PKT_LEN::mask == DP83822_BICSR2_PKT_LENGTH_MASK, "BICSR2 field mismatch");
+static_assert(VOD_CFG1_MINUS_MDI::mask == DP83826_VOD_CFG1_MINUS_MDI_MASK, "VOD_CFG1 field mismatch");
+static_assert(VOD_CFG2_PLUS_MDIX::mask == DP83826_VOD_CFG2_PLUS_MDIX_MASK, "VOD_CFG2 field mismatch");
+static_assert(PHYCR_MDIX_EN::mask == DP83822_MDIX_AUTO_EN, "PHYCR field mismatch");
+static_assert((BMCR_ISOLATE::mask | BMCR_AUTONEG::mask | BMCR_SPEED::mask | BMCR_DUPLEX::mask) ==
+                  (PHY_BCTL_ISOLATE_MASK | PHY_BCTL_AUTONEG_MASK | PHY_BCTL_SPEED0_MASK | PHY_BCTL_DUPLEX_MASK),
+              "BMCR field mismatch");
+static_assert((ANAR_PAUSE::mask | ANAR_ASYM_PAUSE::mask) == (DP83822_AN_PAUSE | DP83822_AN_ASYM_PAUSE),
+              "ANAR field mismatch");
+
+/*! @brief Converts a folded register update into a register script entry. */
+template <typename R>
+constexpr phy_dp83825_script_t script(regfield::Update<R> update)
+{
+    return {(uint8_t)(kPHY_DP83825_ScriptModify | ((R::devAddr != 0U) ? PHY_DP83825_SCRIPT_EXT : 0U)), 0U, R::addr,
+            update.mask, update.value};
+}
+} /* namespace dp83825 */
+#endif /* __cplusplus */
+
+#endif /* _FSL_PHYDP83825_REGS_H_ */
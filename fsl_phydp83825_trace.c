@@ -0,0 +1,180 @@
+/*
+ * fsl_phydp83825_trace.c
+ *
+ *  MDIO access tracing for the DP83825 PHY driver.
+ */
+
+#include "fsl_phydp83825_trace.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#if PHY_DP83825_ENABLE_TRACE && ((PHY_DP83825_TRACE_DEPTH & (PHY_DP83825_TRACE_DEPTH - 1U)) != 0U)
+#error "PHY_DP83825_TRACE_DEPTH must be a power of two"
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+#if PHY_DP83825_ENABLE_TRACE
+static phy_dp83825_trace_record_t s_traceRing[PHY_DP83825_TRACE_DEPTH];
+
+/*! @brief Number of records ever claimed, the ring index is its low bits. */
+static volatile uint32_t s_traceHead;
+
+/*! @brief Value of s_traceHead at the last clear. */
+static volatile uint32_t s_traceStart;
+#endif /* PHY_DP83825_ENABLE_TRACE */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint8_t *PHY_DP83825_TracePut16(uint8_t *out, uint16_t value)
+{
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8U);
+    return out + 2U;
+}
+
+static uint8_t *PHY_DP83825_TracePut32(uint8_t *out, uint32_t value)
+{
+    out = PHY_DP83825_TracePut16(out, (uint16_t)value);
+    return PHY_DP83825_TracePut16(out, (uint16_t)(value >> 16U));
+}
+
+static uint16_t PHY_DP83825_TraceGet16(const uint8_t *in)
+{
+    return (uint16_t)((uint16_t)in[0] | ((uint16_t)in[1] << 8U));
+}
+
+void PHY_DP83825_TraceEncodeHeader(uint8_t *out, uint32_t count, uint32_t lost)
+{
+    assert(out);
+
+    (void)memcpy(out, PHY_DP83825_TRACE_MAGIC, 4U);
+    out[4] = PHY_DP83825_TRACE_VERSION;
+    out[5] = PHY_DP83825_TRACE_RECORD_SIZE;
+    out    = PHY_DP83825_TracePut16(&out[6], 0U);
+    out    = PHY_DP83825_TracePut32(out, count);
+    (void)PHY_DP83825_TracePut32(out, lost);
+}
+
+void PHY_DP83825_TraceEncode(const phy_dp83825_trace_record_t *record, uint8_t *out)
+{
+    assert(record && out);
+
+    out    = PHY_DP83825_TracePut32(out, record->timestamp);
+    out    = PHY_DP83825_TracePut16(out, record->regAddr);
+    out    = PHY_DP83825_TracePut16(out, record->value);
+    out    = PHY_DP83825_TracePut16(out, record->duration);
+    out[0] = record->phyAddr;
+    out[1] = record->devAddr;
+    out[2] = record->op;
+    out    = PHY_DP83825_TracePut16(&out[3], record->status);
+    out[0] = 0U;
+}
+
+void PHY_DP83825_TraceDecode(const uint8_t *in, phy_dp83825_trace_record_t *record)
+{
+    assert(in && record);
+
+    record->timestamp = (uint32_t)PHY_DP83825_TraceGet16(&in[0]) | ((uint32_t)PHY_DP83825_TraceGet16(&in[2]) << 16U);
+    record->regAddr   = PHY_DP83825_TraceGet16(&in[4]);
+    record->value     = PHY_DP83825_TraceGet16(&in[6]);
+    record->duration  = PHY_DP83825_TraceGet16(&in[8]);
+    record->phyAddr   = in[10];
+    record->devAddr   = in[11];
+    record->op        = in[12];
+    record->status    = PHY_DP83825_TraceGet16(&in[13]);
+}
+
+#if PHY_DP83825_ENABLE_TRACE
+
+#if !defined(__GNUC__)
+static uint32_t PHY_DP83825_TraceClaim(volatile uint32_t *counter)
+{
+    uint32_t regPrimask = DisableGlobalIRQ();
+    uint32_t slot       = *counter;
+
+    *counter = slot + 1U;
+    EnableGlobalIRQ(regPrimask);
+    return slot;
+}
+#endif
+
+void PHY_DP83825_TraceRecord(uint8_t phyAddr,
+                             uint8_t op,
+                             uint8_t devAddr,
+                             uint16_t regAddr,
+                             uint16_t value,
+                             status_t status,
+                             uint32_t start,
+                             uint32_t end)
+{
+    phy_dp83825_trace_record_t *record;
+    uint32_t duration = end - start;
+    uint32_t slot;
+
+    /* Each producer claims its own slot, no lock needed. */
+    slot   = PHY_DP83825_TRACE_CLAIM(&s_traceHead);
+    record = &s_traceRing[slot & (PHY_DP83825_TRACE_DEPTH - 1U)];
+
+    record->timestamp = start;
+    record->regAddr   = regAddr;
+    record->value     = value;
+    record->duration  = (duration > 0xFFFFU) ? 0xFFFFU : (uint16_t)duration;
+    record->phyAddr   = phyAddr;
+    record->devAddr   = devAddr;
+    record->op        = op;
+    record->status    = (uint16_t)status;
+}
+
+size_t PHY_DP83825_TraceDump(uint8_t *buffer, size_t size)
+{
+    assert(buffer);
+
+    uint32_t head  = s_traceHead;
+    uint32_t first = s_traceStart;
+    uint32_t lost  = 0U;
+    uint32_t count;
+    uint8_t *out;
+
+    if (size < PHY_DP83825_TRACE_HEADER_SIZE)
+    {
+        return 0U;
+    }
+
+    /* Oldest record still in the ring. */
+    if ((head - first) > PHY_DP83825_TRACE_DEPTH)
+    {
+        lost  = head - first - PHY_DP83825_TRACE_DEPTH;
+        first = head - PHY_DP83825_TRACE_DEPTH;
+    }
+    count = head - first;
+    if (count > ((size - PHY_DP83825_TRACE_HEADER_SIZE) / PHY_DP83825_TRACE_RECORD_SIZE))
+    {
+        count = (uint32_t)((size - PHY_DP83825_TRACE_HEADER_SIZE) / PHY_DP83825_TRACE_RECORD_SIZE);
+        lost += (head - first) - count;
+        first = head - count;
+    }
+
+    PHY_DP83825_TraceEncodeHeader(buffer, count, lost);
+    out = &buffer[PHY_DP83825_TRACE_HEADER_SIZE];
+
+    for (; first != head; first++)
+    {
+        PHY_DP83825_TraceEncode(&s_traceRing[first & (PHY_DP83825_TRACE_DEPTH - 1U)], out);
+        out += PHY_DP83825_TRACE_RECORD_SIZE;
+    }
+    return (size_t)(out - buffer);
+}
+
+void PHY_DP83825_TraceClear(void)
+{
+    s_traceStart = s_traceHead;
+}
+
+#endif /* PHY_DP83825_ENABLE_TRACE */
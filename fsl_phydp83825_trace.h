@@ -0,0 +1,165 @@
+/*
+ * fsl_phydp83825_trace.h
+ *
+ *  MDIO access tracing for the DP83825 PHY driver.
+ */
+
+#ifndef _FSL_PHYDP83825_TRACE_H_
+#define _FSL_PHYDP83825_TRACE_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup phy_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Enables the MDIO trace, compiled out by default. */
+#ifndef PHY_DP83825_ENABLE_TRACE
+#define PHY_DP83825_ENABLE_TRACE (0)
+#endif
+
+/*! @brief Number of records kept by the trace ring buffer, must be a power of two. */
+#ifndef PHY_DP83825_TRACE_DEPTH
+#define PHY_DP83825_TRACE_DEPTH (256U)
+#endif
+
+/*!
+ * @brief Claims the next trace slot, returns the counter value before the increment.
+ *
+ * Uses the compiler atomics where available (GCC, Clang, Arm Compiler 6). Other toolchains, e.g. IAR
+ * and Arm Compiler 5, fall back to the SDK critical section. Define it to a platform atomic, e.g. for
+ * several cores sharing the trace.
+ */
+#ifndef PHY_DP83825_TRACE_CLAIM
+#if defined(__GNUC__)
+#define PHY_DP83825_TRACE_CLAIM(counter) __atomic_fetch_add((counter), 1U, __ATOMIC_RELAXED)
+#else
+#define PHY_DP83825_TRACE_CLAIM(counter) PHY_DP83825_TraceClaim(counter)
+#endif
+#endif
+/*! @brief Trace dump format.
+ *
+ * All fields little endian. A 16 byte header is followed by the records, oldest first.
+ *
+ * Header: magic "PTRC", version (1 byte), record size (1 byte), reserved (2 bytes),
+ * record count (4 bytes, PHY_DP83825_TRACE_STREAM if the records run to the end of the data),
+ * records lost by ring buffer overrun (4 bytes).
+ *
+ * Record: timestamp us (4 bytes), register (2 bytes), value (2 bytes), duration us (2 bytes,
+ * saturated), PHY address (1 byte), MMD device address (1 byte), operation (1 byte, 0 write,
+ * 1 read, 2 extended write, 3 extended read), status (2 bytes, status_t code, 0 success),
+ * reserved (1 byte).
+ *
+ * Version 1 stored the status in one byte followed by the zeroed reserved bytes, which decodes the
+ * same way, so both versions are accepted.
+ */
+#define PHY_DP83825_TRACE_MAGIC       "PTRC"
+#define PHY_DP83825_TRACE_VERSION     (2U)
+#define PHY_DP83825_TRACE_HEADER_SIZE (16U)
+#define PHY_DP83825_TRACE_RECORD_SIZE (16U)
+#define PHY_DP83825_TRACE_STREAM      (0xFFFFFFFFU)
+
+/*! @brief Trace record operations. */
+#define PHY_DP83825_TRACE_OP_WRITE     (0U)
+#define PHY_DP83825_TRACE_OP_READ      (1U)
+#define PHY_DP83825_TRACE_OP_WRITE_EXT (2U)
+#define PHY_DP83825_TRACE_OP_READ_EXT  (3U)
+
+/*! @brief Trace record. */
+typedef struct _phy_dp83825_trace_record
+{
+    uint32_t timestamp; /*!< Frame start, time source microseconds. */
+    uint16_t regAddr;   /*!< Register address. */
+    uint16_t value;     /*!< Value written or read. */
+    uint16_t duration;  /*!< Frame duration in microseconds, saturated to 0xFFFF. */
+    uint16_t status;    /*!< Frame status, status_t codes of all SDK groups fit. */
+    uint8_t phyAddr;    /*!< PHY address. */
+    uint8_t devAddr;    /*!< MMD device address of extended accesses. */
+    uint8_t op;         /*!< Frame type. */
+} phy_dp83825_trace_record_t;
+
+#if PHY_DP83825_ENABLE_TRACE
+#define PHY_DP83825_TRACE(phyAddr, op, devAddr, regAddr, value, status, start, end) \
+    PHY_DP83825_TraceRecord((phyAddr), (op), (devAddr), (regAddr), (value), (status), (start), (end))
+#else
+#define PHY_DP83825_TRACE(phyAddr, op, devAddr, regAddr, value, status, start, end)
+#endif
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Encodes a dump header.
+ *
+ * @param out    Output, PHY_DP83825_TRACE_HEADER_SIZE bytes.
+ * @param count  Number of records following the header.
+ * @param lost   Number of records lost.
+ */
+void PHY_DP83825_TraceEncodeHeader(uint8_t *out, uint32_t count, uint32_t lost);
+
+/*!
+ * @brief Encodes a record in the dump format.
+ *
+ * @param record  Record to encode.
+ * @param out     Output, PHY_DP83825_TRACE_RECORD_SIZE bytes.
+ */
+void PHY_DP83825_TraceEncode(const phy_dp83825_trace_record_t *record, uint8_t *out);
+
+/*!
+ * @brief Decodes a record in the dump format.
+ *
+ * @param in      Input, PHY_DP83825_TRACE_RECORD_SIZE bytes.
+ * @param record  Decoded record.
+ */
+void PHY_DP83825_TraceDecode(const uint8_t *in, phy_dp83825_trace_record_t *record);
+
+#if PHY_DP83825_ENABLE_TRACE
+/*!
+ * @brief Records one MDIO frame.
+ *
+ * Called by the driver for every frame. Safe to call from several tasks and interrupts, see
+ * PHY_DP83825_TRACE_CLAIM.
+ */
+void PHY_DP83825_TraceRecord(uint8_t phyAddr,
+                             uint8_t op,
+                             uint8_t devAddr,
+                             uint16_t regAddr,
+                             uint16_t value,
+                             status_t status,
+                             uint32_t start,
+                             uint32_t end);
+
+/*!
+ * @brief Dumps the trace in the binary dump format.
+ *
+ * Records written while dumping may be torn, stop the PHY traffic for a consistent dump.
+ *
+ * @param buffer  Output buffer.
+ * @param size    Output buffer size, records not fitting are dropped from the start.
+ * @return Number of bytes written, 0 if the buffer can not hold the header.
+ */
+size_t PHY_DP83825_TraceDump(uint8_t *buffer, size_t size);
+
+/*!
+ * @brief Clears the trace.
+ */
+void PHY_DP83825_TraceClear(void);
+#endif /* PHY_DP83825_ENABLE_TRACE */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_PHYDP83825_TRACE_H_ */
@@ -8,40 +8,52 @@
 #include "fsl_phydp83825.h"
 #include "fsl_iomuxc.h"
 #include "fsl_enet.h"
+#include "mdio_phydp83825.h"
 
 phy_dp83825_resource_t g_phy_resource;
+static phy_dp83825_bus_t s_phyBus;
 
-static void MDIO_Init(void)
+static void MDIO_Init(ENET_Type *base)
 {
-    (void)CLOCK_EnableClock(s_enetClock[ENET_GetInstance(ENET)]);
-    ENET_SetSMI(ENET, CLOCK_GetFreq(kCLOCK_IpgClk), false);
+    (void)CLOCK_EnableClock(s_enetClock[ENET_GetInstance(base)]);
+    ENET_SetSMI(base, CLOCK_GetFreq(kCLOCK_IpgClk), false);
 }
 
-static status_t MDIO_Write(uint8_t phyAddr, uint8_t regAddr, uint16_t data)
+static status_t MDIO_BusWrite(void *context, uint8_t phyAddr, uint8_t regAddr, uint16_t data)
 {
-    return ENET_MDIOWrite(ENET, phyAddr, regAddr, data);
+    return ENET_MDIOWrite((ENET_Type *)context, phyAddr, regAddr, data);
 }
 
-static status_t MDIO_Read(uint8_t phyAddr, uint8_t regAddr, uint16_t *pData)
+static status_t MDIO_BusRead(void *context, uint8_t phyAddr, uint8_t regAddr, uint16_t *pData)
 {
-    return ENET_MDIORead(ENET, phyAddr, regAddr, pData);
+    return ENET_MDIORead((ENET_Type *)context, phyAddr, regAddr, pData);
 }
 
-static status_t MDIO_ExtendedWrite(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data)
+static status_t MDIO_BusExtendedWrite(void *context, uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data)
 {
-    return ENET_MDIOC45Write(ENET, phyAddr, devAddr, regAddr, data);
+    return ENET_MDIOC45Write((ENET_Type *)context, phyAddr, devAddr, regAddr, data);
 }
 
-static status_t MDIO_ExtendedRead(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData)
+static status_t MDIO_BusExtendedRead(void *context, uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData)
 {
-    return ENET_MDIOC45Read(ENET, phyAddr, devAddr, regAddr, pData);
+    return ENET_MDIOC45Read((ENET_Type *)context, phyAddr, devAddr, regAddr, pData);
 }
 
 void mdio_phydp83825_init(void)
 {
-	MDIO_Init();
-    g_phy_resource.read  = MDIO_Read;
-    g_phy_resource.write = MDIO_Write;
-    g_phy_resource.readExt = MDIO_ExtendedRead;
-    g_phy_resource.writeExt = MDIO_ExtendedWrite;
+    /* The single PHY runs on the bus of ENET, the pool instances on their own buses. */
+    mdio_phydp83825_bus_init(&s_phyBus, ENET, 0U);
+    g_phy_resource.bus = &s_phyBus;
+}
+
+void mdio_phydp83825_bus_init(phy_dp83825_bus_t *bus, ENET_Type *base, uint8_t busId)
+{
+    MDIO_Init(base);
+    (void)memset(bus, 0, sizeof(*bus));
+    bus->write    = MDIO_BusWrite;
+    bus->read     = MDIO_BusRead;
+    bus->writeExt = MDIO_BusExtendedWrite;
+    bus->readExt  = MDIO_BusExtendedRead;
+    bus->context  = base;
+    bus->busId    = busId;
 }
@@ -8,6 +8,17 @@
 #ifndef MDIO_PHYDP83825_H_
 #define MDIO_PHYDP83825_H_
 
+#include "fsl_phydp83825.h"
+#include "fsl_enet.h"
+
+/* Sets up the MDIO of ENET as bus 0 and binds g_phy_resource to it, for a single PHY. */
 void mdio_phydp83825_init(void);
 
+/*
+ * Sets up the MDIO of one ENET instance as a PHY bus, for PHY_DP83825_PoolOpen(). The pool needs
+ * this bus path: resource functions without a context would drive the PHYs of every bus through
+ * one ENET.
+ */
+void mdio_phydp83825_bus_init(phy_dp83825_bus_t *bus, ENET_Type *base, uint8_t busId);
+
 #endif /* MDIO_PHYDP83825_H_ */
@@ -0,0 +1,107 @@
+/*
+ * regfield.h
+ *
+ *  Register field helpers. The C macros work on the masks built with bits.h, the C++
+ *  descriptors add compile time checks and fold several field updates of one register
+ *  into a single mask/value pair.
+ */
+
+#ifndef REGFIELD_H_
+#define REGFIELD_H_
+
+#include <stdint.h>
+
+/*! @brief Lowest set bit of a field mask. */
+#define FIELD_LSB(mask) ((mask) & (~(mask) + 1U))
+
+/*! @brief Places a field value into its register position. */
+#define FIELD_PREP(mask, val) ((((uint32_t)(val)) * FIELD_LSB(mask)) & (mask))
+
+/*! @brief Extracts a field value from a register value. */
+#define FIELD_GET(mask, reg) ((((uint32_t)(reg)) & (mask)) / FIELD_LSB(mask))
+
+/*! @brief Replaces a field in a register value. */
+#define FIELD_MODIFY(mask, reg, val) ((((uint32_t)(reg)) & ~(uint32_t)(mask)) | FIELD_PREP(mask, val))
+
+#if defined(__cplusplus)
+namespace regfield
+{
+/*!
+ * @brief 16-bit register descriptor.
+ *
+ * @tparam Addr     Register address.
+ * @tparam DevAddr  MMD device address of extended registers, 0 for basic registers.
+ */
+template <uint16_t Addr, uint8_t DevAddr = 0U>
+struct Reg
+{
+    static constexpr uint16_t addr   = Addr;
+    static constexpr uint8_t devAddr = DevAddr;
+};
+
+/*!
+ * @brief Update of some bits of register R.
+ *
+ * Updates of the same register combine with operator|, later updates win on overlapping
+ * bits. Combining updates of different registers does not compile.
+ */
+template <typename R>
+struct Update
+{
+    uint16_t mask;
+    uint16_t value;
+
+    constexpr Update operator|(Update other) const
+    {
+        return {(uint16_t)(mask | other.mask), (uint16_t)((value & ~other.mask) | other.value)};
+    }
+
+    template <typename Other>
+    constexpr Update operator|(Update<Other>) const
+    {
+        static_assert(sizeof(Other) == 0U, "field updates of different registers can not be combined");
+        return *this;
+    }
+
+    /*! @brief Applies the update to a register value. */
+    constexpr uint16_t apply(uint16_t reg) const
+    {
+        return (uint16_t)((reg & ~mask) | value);
+    }
+};
+
+/*!
+ * @brief Field descriptor of bits Hi..Lo of register R.
+ */
+template <typename R, unsigned Hi, unsigned Lo>
+struct Field
+{
+    static_assert((Hi < 16U) && (Lo <= Hi), "field does not fit a 16-bit register");
+
+    using reg = R;
+    static constexpr uint16_t mask = (uint16_t)(((1UL << (Hi - Lo + 1U)) - 1U) << Lo);
+
+    /*! @brief Update with a value checked at compile time. */
+    template <uint16_t V>
+    static constexpr Update<R> set()
+    {
+        static_assert((V >> (Hi - Lo + 1U)) == 0U, "value does not fit the field");
+        return {mask, (uint16_t)(V << Lo)};
+    }
+
+    /*! @brief Update with a run time value, truncated to the field width. */
+    static constexpr Update<R> prep(uint16_t value)
+    {
+        return {mask, (uint16_t)((value << Lo) & mask)};
+    }
+
+    /*! @brief Extracts the field from a register value. */
+    static constexpr uint16_t get(uint16_t reg)
+    {
+        return (uint16_t)((reg & mask) >> Lo);
+    }
+};
+} /* namespace regfield */
+#endif /* __cplusplus */
+
+#endif /* REGFIELD_H_ */
@@ -0,0 +1,71 @@
+/*
+ * fsl_common.h
+ *
+ *  Host stand-in for the SDK fsl_common.h, with the subset the DP83825 PHY driver uses. Only for
+ *  the host tests, target builds take the header of the SDK.
+ */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*! @brief Constructs a status code value from a group and code number, as the SDK does. */
+#define MAKE_STATUS(group, code) ((((group)*100) + (code)))
+
+/*! @brief Constructs the version number for drivers. */
+#define MAKE_VERSION(major, minor, bugfix) (((major) << 16) | ((minor) << 8) | (bugfix))
+
+/*! @brief Status group numbers. */
+enum _status_groups
+{
+    kStatusGroup_Generic = 0,
+    kStatusGroup_ENET    = 40,
+};
+
+/*! @brief Generic status return codes. */
+enum _generic_status
+{
+    kStatus_Success              = MAKE_STATUS(kStatusGroup_Generic, 0),
+    kStatus_Fail                 = MAKE_STATUS(kStatusGroup_Generic, 1),
+    kStatus_ReadOnly             = MAKE_STATUS(kStatusGroup_Generic, 2),
+    kStatus_OutOfRange           = MAKE_STATUS(kStatusGroup_Generic, 3),
+    kStatus_InvalidArgument      = MAKE_STATUS(kStatusGroup_Generic, 4),
+    kStatus_Timeout              = MAKE_STATUS(kStatusGroup_Generic, 5),
+    kStatus_NoTransferInProgress = MAKE_STATUS(kStatusGroup_Generic, 6),
+    kStatus_Busy                 = MAKE_STATUS(kStatusGroup_Generic, 7),
+    kStatus_NoData               = MAKE_STATUS(kStatusGroup_Generic, 8),
+};
+
+/*! @brief Type used for all status and error return values. */
+typedef int32_t status_t;
+
+#define SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY (600000000U)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*! @brief Busy delay, provided by the PHY model of the host tests. */
+void SDK_DelayAtLeastUs(uint32_t delayTime_us, uint32_t coreClock_Hz);
+
+/*! @brief There are no interrupts on the host, the critical section is empty. */
+static inline uint32_t DisableGlobalIRQ(void)
+{
+    return 0U;
+}
+
+static inline void EnableGlobalIRQ(uint32_t primask)
+{
+    (void)primask;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* _FSL_COMMON_H_ */
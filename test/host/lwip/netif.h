@@ -0,0 +1,30 @@
+/*
+ * netif.h
+ *
+ *  Host stand-in for the lwIP netif.h, with the subset the DP83825 lwIP glue uses.
+ */
+
+#ifndef LWIP_HDR_NETIF_H
+#define LWIP_HDR_NETIF_H
+
+#include <stdint.h>
+
+/*! @brief The netif, only its link state. */
+struct netif
+{
+    uint8_t linkUp;       /*!< Link state set through netif_set_link_up/down. */
+    uint32_t linkChanges; /*!< Link state changes. */
+};
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void netif_set_link_up(struct netif *netif);
+void netif_set_link_down(struct netif *netif);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LWIP_HDR_NETIF_H */
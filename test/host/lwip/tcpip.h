@@ -0,0 +1,36 @@
+/*
+ * tcpip.h
+ *
+ *  Host stand-in for the lwIP tcpip.h, with the subset the DP83825 lwIP glue uses. The test
+ *  provides the functions, with a mailbox it empties itself in place of the tcpip thread.
+ */
+
+#ifndef LWIP_HDR_TCPIP_H
+#define LWIP_HDR_TCPIP_H
+
+#include <stdint.h>
+
+typedef int8_t err_t;
+
+#define ERR_OK  (0)
+#define ERR_MEM (-1)
+
+typedef void (*tcpip_callback_fn)(void *ctx);
+
+struct tcpip_callback_msg;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+err_t tcpip_callback(tcpip_callback_fn function, void *ctx);
+struct tcpip_callback_msg *tcpip_callbackmsg_new(tcpip_callback_fn function, void *ctx);
+void tcpip_callbackmsg_delete(struct tcpip_callback_msg *msg);
+err_t tcpip_callbackmsg_trycallback(struct tcpip_callback_msg *msg);
+err_t tcpip_callbackmsg_trycallback_fromisr(struct tcpip_callback_msg *msg);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LWIP_HDR_TCPIP_H */
@@ -0,0 +1,25 @@
+/*
+ * timeouts.h
+ *
+ *  Host stand-in for the lwIP timeouts.h, with the subset the DP83825 lwIP glue uses.
+ */
+
+#ifndef LWIP_HDR_TIMEOUTS_H
+#define LWIP_HDR_TIMEOUTS_H
+
+#include <stdint.h>
+
+typedef void (*sys_timeout_handler)(void *arg);
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void sys_timeout(uint32_t msecs, sys_timeout_handler handler, void *arg);
+void sys_untimeout(sys_timeout_handler handler, void *arg);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LWIP_HDR_TIMEOUTS_H */
@@ -0,0 +1,259 @@
+/*
+ * phydp83825_async_bench.cpp
+ *
+ *  Executor throughput of the coroutine interface in fsl_phydp83825_async.h against the PHY model:
+ *  MDIO frames per second for PHYs brought up and polled through the blocking API, through
+ *  dp83825::async::Phy on a bus completing in place, and on a bus completing later with the
+ *  frames of all PHYs in flight at once. The model frames take no time, the numbers are the
+ *  software cost per frame.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "fsl_phydp83825_async.h"
+#include "phydp83825_sim.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_PHYS   (16U)
+#define TEST_POLLS  (2000U)
+#define TEST_ROUNDS (5U)
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+namespace
+{
+using namespace dp83825::async;
+using Clock = std::chrono::steady_clock;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+phy_dp83825_sim_bus_t s_bus;
+phy_dp83825_sim_phy_t s_phys[TEST_PHYS];
+phy_dp83825_resource_t s_resource;
+uint32_t s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*! @brief Bus completing each frame later from the executor loop, like an interrupt driven MDIO controller. */
+class DeferredBus : public Bus
+{
+public:
+    explicit DeferredBus(ResourceBus &bus) : m_bus(bus)
+    {
+    }
+
+    void read(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, Completion done) override
+    {
+        m_bus.read(phyAddr, devAddr, regAddr, Completion{&DeferredBus::defer, &queue(done)});
+    }
+
+    void write(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data, Completion done) override
+    {
+        m_bus.write(phyAddr, devAddr, regAddr, data, Completion{&DeferredBus::defer, &queue(done)});
+    }
+
+    /*! @brief Completes the frames issued so far, returns their number. */
+    size_t complete()
+    {
+        std::deque<Pending> pending;
+        size_t count;
+
+        pending.swap(m_pending);
+        count = pending.size();
+        m_maxInFlight = (count > m_maxInFlight) ? count : m_maxInFlight;
+        for (Pending &frame : pending)
+        {
+            frame.done(frame.status, frame.data);
+        }
+        return count;
+    }
+
+    size_t maxInFlight() const
+    {
+        return m_maxInFlight;
+    }
+
+private:
+    struct Pending
+    {
+        Completion done;
+        status_t status;
+        uint16_t data;
+    };
+
+    Pending &queue(Completion done)
+    {
+        m_pending.push_back(Pending{done, kStatus_Success, 0U});
+        return m_pending.back();
+    }
+
+    static void defer(void *context, status_t status, uint16_t data)
+    {
+        Pending *frame = static_cast<Pending *>(context);
+
+        frame->status = status;
+        frame->data   = data;
+    }
+
+    ResourceBus &m_bus;
+    std::deque<Pending> m_pending;
+    size_t m_maxInFlight = 0U;
+};
+
+Task<void> PollPhy(Phy &phy, bool linkUp, status_t &status)
+{
+    phy_config_t config = {};
+
+    config.autoNeg = true;
+    status         = co_await phy.init(config);
+    for (uint32_t poll = 0U; (poll < TEST_POLLS) && (status == kStatus_Success); poll++)
+    {
+        Result<Link> link = co_await phy.link();
+        status            = link.status;
+        if (link.value.up != linkUp)
+        {
+            status = kStatus_Fail;
+        }
+    }
+}
+
+void Report(const char *name, uint32_t frames, Clock::duration elapsed)
+{
+    double seconds = std::chrono::duration<double>(elapsed).count();
+
+    printf("%-28s %8u frames  %7.1f ns/frame  %6.2f Mframes/s\n", name, frames, (seconds * 1e9) / frames,
+           (frames / seconds) / 1e6);
+}
+
+void TEST_Setup()
+{
+    PHY_DP83825_SimBusInit(&s_bus, 0U);
+    for (uint8_t addr = 0U; addr < TEST_PHYS; addr++)
+    {
+        PHY_DP83825_SimAttach(&s_bus, addr, &s_phys[addr], DP83825I_PHY_ID);
+        if ((addr & 1U) != 0U)
+        {
+            PHY_DP83825_SimSetLink(&s_phys[addr], true, kPHY_Speed100M, kPHY_FullDuplex);
+        }
+    }
+    (void)memset(&s_resource, 0, sizeof(s_resource));
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+}
+
+/* The blocking API, one PHY after the other. */
+Clock::duration TEST_Blocking(uint32_t &frames)
+{
+    std::vector<phy_dp83825_resource_t> resources(TEST_PHYS, s_resource);
+    std::vector<phy_handle_t> handles(TEST_PHYS);
+    uint32_t start         = s_bus.frames;
+    Clock::time_point time = Clock::now();
+    phy_config_t config    = {};
+    bool up;
+
+    config.ops     = &phydp83825_ops;
+    config.autoNeg = true;
+    for (uint8_t addr = 0U; addr < TEST_PHYS; addr++)
+    {
+        config.phyAddr  = addr;
+        config.resource = &resources[addr];
+        CHECK(PHY_Init(&handles[addr], &config) == kStatus_Success);
+        for (uint32_t poll = 0U; poll < TEST_POLLS; poll++)
+        {
+            CHECK(PHY_GetLinkStatus(&handles[addr], &up) == kStatus_Success);
+            CHECK(up == ((addr & 1U) != 0U));
+        }
+    }
+    frames = s_bus.frames - start;
+    return Clock::now() - time;
+}
+
+/* The coroutines of all PHYs on one executor, frames through bus. */
+Clock::duration TEST_Async(Bus &bus, DeferredBus *deferred, uint32_t &frames)
+{
+    Executor executor;
+    std::vector<std::unique_ptr<Phy>> phys;
+    std::vector<status_t> status(TEST_PHYS, kStatus_Fail);
+    uint32_t start         = s_bus.frames;
+    Clock::time_point time = Clock::now();
+
+    for (uint8_t addr = 0U; addr < TEST_PHYS; addr++)
+    {
+        phys.push_back(std::make_unique<Phy>(executor, bus, addr));
+        executor.spawn(PollPhy(*phys.back(), (addr & 1U) != 0U, status[addr]));
+    }
+    if (deferred == nullptr)
+    {
+        executor.run();
+    }
+    else
+    {
+        do
+        {
+            while (executor.runOne())
+            {
+            }
+        } while ((deferred->complete() != 0U) || executor.busy());
+    }
+    frames = s_bus.frames - start;
+    Clock::duration elapsed = Clock::now() - time;
+
+    for (status_t result : status)
+    {
+        CHECK(result == kStatus_Success);
+    }
+    return elapsed;
+}
+} /* namespace */
+
+int main()
+{
+    ResourceBus inPlace(s_resource);
+    DeferredBus deferred(inPlace);
+    Clock::duration best[3] = {Clock::duration::max(), Clock::duration::max(), Clock::duration::max()};
+    uint32_t frames[3]      = {0U, 0U, 0U};
+
+    /* Best of a few rounds, the first ones warm up the caches and the allocator. */
+    for (uint32_t round = 0U; round < TEST_ROUNDS; round++)
+    {
+        Clock::duration elapsed;
+
+        TEST_Setup();
+        elapsed = TEST_Blocking(frames[0]);
+        best[0] = (elapsed < best[0]) ? elapsed : best[0];
+        TEST_Setup();
+        elapsed = TEST_Async(inPlace, nullptr, frames[1]);
+        best[1] = (elapsed < best[1]) ? elapsed : best[1];
+        TEST_Setup();
+        elapsed = TEST_Async(deferred, &deferred, frames[2]);
+        best[2] = (elapsed < best[2]) ? elapsed : best[2];
+    }
+
+    printf("%u PHYs, init and %u link polls each\n", TEST_PHYS, TEST_POLLS);
+    Report("blocking API", frames[0], best[0]);
+    Report("async, completed in place", frames[1], best[1]);
+    Report("async, completed later", frames[2], best[2]);
+    printf("frames in flight at once: %zu\n", deferred.maxInFlight());
+    CHECK(deferred.maxInFlight() == TEST_PHYS);
+
+    printf("phydp83825_async_bench: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
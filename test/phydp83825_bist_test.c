@@ -0,0 +1,171 @@
+/*
+ * phydp83825_bist_test.c
+ *
+ *  Built-in self test of the DP83825 PHY driver against the PHY model: PRBS error counting and
+ *  saturation, the checker lock, the configuration restored afterwards, and the API call deadline
+ *  held across the nested calls of PHY_DP83825_RunBist().
+ */
+
+#include <stdio.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PHY_TEST_ADDR (1U)
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static phy_dp83825_sim_bus_t s_bus;
+static phy_dp83825_sim_phy_t s_phy;
+static phy_dp83825_resource_t s_resource;
+static phy_handle_t s_handle;
+static uint32_t s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_Init(void)
+{
+    phy_config_t config = {0};
+
+    PHY_DP83825_SimBusInit(&s_bus, 25U);
+    PHY_DP83825_SimAttach(&s_bus, PHY_TEST_ADDR, &s_phy, DP83825I_PHY_ID);
+    (void)memset(&s_resource, 0, sizeof(s_resource));
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+    config.phyAddr  = PHY_TEST_ADDR;
+    config.resource = &s_resource;
+    config.ops      = &phydp83825_ops;
+    config.autoNeg  = true;
+    CHECK(PHY_Init(&s_handle, &config) == kStatus_Success);
+}
+
+/* Errors injected at a known rate come back in the statistics, the counter is emptied in time. */
+static void TEST_BistErrors(void)
+{
+    phy_dp83825_bist_config_t config = {kPHY_DP83825_LoopbackDigital, kPHY_Speed100M, 1500U, 12U};
+    phy_dp83825_bist_stats_t stats;
+    uint16_t bmcr = s_phy.regs[PHY_BASICCONTROL_REG];
+    uint32_t expected;
+
+    /*
+     * 100000 packets of 1520 byte times are 1.216 * 10^9 line bits, the polls add a little. The
+     * rate is reported per data bit, 1500 of the 1520 bytes.
+     */
+    s_phy.bistErrorsPerGbit = 1000U;
+    CHECK(PHY_DP83825_RunBist(&s_handle, &config, 100000U, &stats) == kStatus_Success);
+    expected = stats.elapsedUs / 10000U;
+    CHECK(stats.locked);
+    CHECK(!stats.syncLost);
+    CHECK(!stats.saturated);
+    CHECK(stats.packets >= 100000U);
+    CHECK((stats.elapsedUs >= 12160000U) && (stats.elapsedUs < 12300000U));
+    CHECK((stats.errors + 1U >= expected) && (stats.errors <= expected + 1U));
+    CHECK((stats.errorsPerGbit >= 1005U) && (stats.errorsPerGbit <= 1020U));
+    CHECK((stats.throughputKbps > 95000U) && (stats.throughputKbps <= 100000U));
+
+    /* The generator stops and the loopback is left. */
+    CHECK((s_phy.regs[MII_DP83822_BISCR] & DP83822_BISCR_PKT_GEN_EN) == 0U);
+    CHECK(s_phy.regs[PHY_BASICCONTROL_REG] == bmcr);
+
+    /* At 10 Mbps the same packets take ten times longer, the error rate stays. */
+    config.speed = kPHY_Speed10M;
+    CHECK(PHY_DP83825_RunBist(&s_handle, &config, 10000U, &stats) == kStatus_Success);
+    CHECK(stats.locked);
+    CHECK((stats.errorsPerGbit >= 1000U) && (stats.errorsPerGbit <= 1025U));
+    CHECK((stats.elapsedUs >= 12160000U) && (stats.elapsedUs < 12300000U));
+}
+
+/* More than 255 errors between two polls saturate the 8 bit counter, the count is a lower bound. */
+static void TEST_BistSaturation(void)
+{
+    phy_dp83825_bist_config_t config = {kPHY_DP83825_LoopbackDigital, kPHY_Speed100M, 1500U, 12U};
+    phy_dp83825_bist_stats_t stats;
+
+    s_phy.bistErrorsPerGbit = 1000000U;
+    CHECK(PHY_DP83825_RunBist(&s_handle, &config, 10000U, &stats) == kStatus_Success);
+    CHECK(stats.saturated);
+    CHECK(stats.errors < 121600U);
+    s_phy.bistErrorsPerGbit = 0U;
+}
+
+/* Without a loopback and without a link nothing comes back, the checker never locks. */
+static void TEST_BistNoLock(void)
+{
+    phy_dp83825_bist_config_t config = {kPHY_DP83825_LoopbackNone, kPHY_Speed100M, 64U, 12U};
+    phy_dp83825_bist_stats_t stats;
+
+    CHECK(PHY_DP83825_RunBist(&s_handle, &config, 1000U, &stats) == kStatus_Success);
+    CHECK(!stats.locked);
+    config.loopback = kPHY_DP83825_LoopbackReverse;
+    CHECK(PHY_DP83825_StartBist(&s_handle, &config) == kStatus_InvalidArgument);
+}
+
+/*
+ * The deadline counts from the start of PHY_DP83825_RunBist(), the nested StartBist, GetBistStats
+ * and StopBist calls must not restart it. The bus fails for good after the second poll, 20 ms
+ * in, past the 10 ms deadline: no frame may be retried.
+ */
+static void TEST_BistDeadline(void)
+{
+    phy_dp83825_bist_config_t config = {kPHY_DP83825_LoopbackDigital, kPHY_Speed100M, 1500U, 12U};
+    phy_dp83825_retry_policy_t policy = {0};
+    phy_dp83825_retry_stats_t before;
+    phy_dp83825_retry_stats_t after;
+    phy_dp83825_bist_stats_t stats;
+    uint32_t startFrames;
+
+    /* Frames of starting the test. */
+    startFrames = s_bus.frames;
+    CHECK(PHY_DP83825_StartBist(&s_handle, &config) == kStatus_Success);
+    startFrames = s_bus.frames - startFrames;
+    CHECK(PHY_DP83825_StopBist(&s_handle, NULL) == kStatus_Success);
+
+    policy.backoffUs      = 100U;
+    policy.maxRetries     = 255U;
+    policy.callDeadlineUs = 10000U;
+    PHY_DP83825_SetRetryPolicy(&s_handle, &policy);
+    PHY_DP83825_GetRetryStats(&s_handle, &before);
+
+    /* 5000 packets take 608 ms, each poll reads BICSR1 and BISCR. */
+    s_bus.failAfter  = startFrames + (2U * 2U);
+    s_bus.failFrames = UINT32_MAX;
+    CHECK(PHY_DP83825_RunBist(&s_handle, &config, 5000U, &stats) == kStatus_Timeout);
+    s_bus.failAfter  = 0U;
+    s_bus.failFrames = 0U;
+
+    PHY_DP83825_GetRetryStats(&s_handle, &after);
+    CHECK(after.retries == before.retries);
+    CHECK(after.deadlines > before.deadlines);
+
+    (void)memset(&policy, 0, sizeof(policy));
+    PHY_DP83825_SetRetryPolicy(&s_handle, &policy);
+}
+
+int main(void)
+{
+    TEST_Init();
+    TEST_BistErrors();
+    TEST_BistSaturation();
+    TEST_BistNoLock();
+    TEST_BistDeadline();
+
+    printf("phydp83825_bist_test: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
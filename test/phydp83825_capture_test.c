@@ -0,0 +1,242 @@
+/*
+ * phydp83825_capture_test.c
+ *
+ *  MDIO capture and replay of the DP83825 PHY driver against the PHY model: the initialization
+ *  and a link poll captured, then replayed to the driver frame for frame on the replay clock, with
+ *  a changed write reported at its frame and the frame count of the header honoured.
+ */
+
+#include <stdio.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_capture.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PHY_TEST_ADDR     (1U)
+#define TEST_FRAME_US     (25U)
+#define TEST_CAPTURE_SIZE (PHY_DP83825_TRACE_HEADER_SIZE + (1024U * PHY_DP83825_TRACE_RECORD_SIZE))
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static phy_dp83825_sim_bus_t s_bus;
+static phy_dp83825_sim_phy_t s_phy;
+static phy_dp83825_resource_t s_resource;
+static phy_handle_t s_handle;
+static uint32_t s_failures;
+
+static uint8_t s_capture[TEST_CAPTURE_SIZE];
+static uint32_t s_captureSize;
+static bool s_captureOverflow;
+
+/* First divergence reported by the replay. */
+static uint32_t s_divergences;
+static uint32_t s_divergenceIndex;
+static phy_dp83825_trace_record_t s_divergenceExpected;
+static phy_dp83825_trace_record_t s_divergenceActual;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_Sink(const uint8_t *data, uint32_t length)
+{
+    if ((s_captureSize + length) > sizeof(s_capture))
+    {
+        s_captureOverflow = true;
+        return;
+    }
+    (void)memcpy(&s_capture[s_captureSize], data, length);
+    s_captureSize += length;
+}
+
+static void TEST_Divergence(uint32_t index,
+                            const phy_dp83825_trace_record_t *expected,
+                            const phy_dp83825_trace_record_t *actual)
+{
+    if (s_divergences == 0U)
+    {
+        s_divergenceIndex    = index;
+        s_divergenceExpected = *expected;
+        s_divergenceActual   = *actual;
+    }
+    s_divergences++;
+}
+
+/* Initializes the PHY and polls the link once, as captured and as replayed. */
+static status_t TEST_Session(void)
+{
+    phy_config_t config = {0};
+    status_t result;
+    bool up = false;
+
+    config.phyAddr  = PHY_TEST_ADDR;
+    config.resource = &s_resource;
+    config.ops      = &phydp83825_ops;
+    config.autoNeg  = true;
+    result          = PHY_Init(&s_handle, &config);
+    if (result == kStatus_Success)
+    {
+        result = PHY_GetLinkStatus(&s_handle, &up);
+    }
+    if ((result == kStatus_Success) && !up)
+    {
+        result = kStatus_Fail;
+    }
+    return result;
+}
+
+static void TEST_Capture(void)
+{
+    PHY_DP83825_SimBusInit(&s_bus, TEST_FRAME_US);
+    PHY_DP83825_SimAttach(&s_bus, PHY_TEST_ADDR, &s_phy, DP83825I_PHY_ID);
+    PHY_DP83825_SimSetLink(&s_phy, true, kPHY_Speed100M, kPHY_FullDuplex);
+    (void)memset(&s_resource, 0, sizeof(s_resource));
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+
+    s_captureSize = 0U;
+    PHY_DP83825_CaptureStart(&s_resource, TEST_Sink);
+    CHECK(TEST_Session() == kStatus_Success);
+    PHY_DP83825_CaptureStop(&s_resource);
+    CHECK(!s_captureOverflow);
+}
+
+/* Replays the first size bytes of the capture, returns the statistics. */
+static status_t TEST_Replay(uint32_t size, phy_dp83825_replay_stats_t *stats)
+{
+    status_t result;
+
+    (void)memset(&s_resource, 0, sizeof(s_resource));
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+    s_divergences = 0U;
+    CHECK(PHY_DP83825_ReplayStart(&s_resource, s_capture, size, false, TEST_Divergence) == kStatus_Success);
+    result = TEST_Session();
+    PHY_DP83825_ReplayGetStats(stats);
+    PHY_DP83825_ReplayStop(&s_resource);
+    CHECK(s_resource.read != NULL);
+    return result;
+}
+
+static void TEST_Record(uint32_t index, phy_dp83825_trace_record_t *record)
+{
+    PHY_DP83825_TraceDecode(&s_capture[PHY_DP83825_TRACE_HEADER_SIZE + (index * PHY_DP83825_TRACE_RECORD_SIZE)],
+                            record);
+}
+
+/* The capture replays without a divergence, frame for frame and on the clock of the capture. */
+static void TEST_ReplayRoundTrip(void)
+{
+    phy_dp83825_replay_stats_t stats;
+    phy_dp83825_trace_record_t first;
+    phy_dp83825_trace_record_t last;
+    uint32_t frames;
+
+    TEST_Capture();
+    frames = (s_captureSize - PHY_DP83825_TRACE_HEADER_SIZE) / PHY_DP83825_TRACE_RECORD_SIZE;
+    CHECK(frames != 0U);
+    CHECK(memcmp(s_capture, PHY_DP83825_TRACE_MAGIC, 4U) == 0);
+
+    /* Streamed captures do not know their frame count. */
+    CHECK((s_capture[8] == 0xFFU) && (s_capture[9] == 0xFFU) && (s_capture[10] == 0xFFU) && (s_capture[11] == 0xFFU));
+
+    CHECK(TEST_Replay(s_captureSize, &stats) == kStatus_Success);
+    CHECK(stats.frames == frames);
+    CHECK(stats.divergences == 0U);
+    CHECK(s_divergences == 0U);
+    CHECK(!stats.exhausted);
+
+    /* The replay clock spans the capture: recorded frame durations plus the same driver delays. */
+    TEST_Record(0U, &first);
+    TEST_Record(frames - 1U, &last);
+    CHECK(stats.elapsedUs == ((last.timestamp + last.duration) - first.timestamp));
+    printf("%u frames captured, replayed in %u us\n", frames, stats.elapsedUs);
+}
+
+/* A capture with a write the driver does not issue diverges at that frame, and only there. */
+static void TEST_ReplayDivergence(void)
+{
+    phy_dp83825_replay_stats_t stats;
+    phy_dp83825_trace_record_t record;
+    uint32_t frames = (s_captureSize - PHY_DP83825_TRACE_HEADER_SIZE) / PHY_DP83825_TRACE_RECORD_SIZE;
+    uint32_t index;
+    uint16_t value;
+
+    /* The middle write of the capture. */
+    for (index = frames / 2U; index < frames; index++)
+    {
+        TEST_Record(index, &record);
+        if (record.op == PHY_DP83825_TRACE_OP_WRITE)
+        {
+            break;
+        }
+    }
+    CHECK(index < frames);
+    value = record.value;
+    record.value ^= 0x0100U;
+    PHY_DP83825_TraceEncode(&record,
+                            &s_capture[PHY_DP83825_TRACE_HEADER_SIZE + (index * PHY_DP83825_TRACE_RECORD_SIZE)]);
+
+    CHECK(TEST_Replay(s_captureSize, &stats) == kStatus_Success);
+    CHECK(stats.frames == frames);
+    CHECK(stats.divergences == 1U);
+    CHECK(stats.firstDivergence == index);
+    CHECK(s_divergences == 1U);
+    CHECK(s_divergenceIndex == index);
+    CHECK(s_divergenceExpected.value == record.value);
+    CHECK(s_divergenceActual.value == value);
+    CHECK(s_divergenceActual.regAddr == record.regAddr);
+    printf("write of 0x%04x to register 0x%02x changed, diverged at frame %u of %u\n", value, record.regAddr, index,
+           frames);
+
+    record.value = value;
+    PHY_DP83825_TraceEncode(&record,
+                            &s_capture[PHY_DP83825_TRACE_HEADER_SIZE + (index * PHY_DP83825_TRACE_RECORD_SIZE)]);
+}
+
+/* A frame count in the header ends the replay there, as does a capture cut short. */
+static void TEST_ReplayCount(void)
+{
+    phy_dp83825_replay_stats_t stats;
+    uint32_t frames = (s_captureSize - PHY_DP83825_TRACE_HEADER_SIZE) / PHY_DP83825_TRACE_RECORD_SIZE;
+    uint8_t header[PHY_DP83825_TRACE_HEADER_SIZE];
+
+    (void)memcpy(header, s_capture, sizeof(header));
+    PHY_DP83825_TraceEncodeHeader(s_capture, frames / 2U, 0U);
+    CHECK(TEST_Replay(s_captureSize, &stats) != kStatus_Success);
+    CHECK(stats.exhausted);
+    CHECK(stats.frames == (frames / 2U));
+    (void)memcpy(s_capture, header, sizeof(header));
+
+    /* A torn last record is dropped. */
+    CHECK(TEST_Replay(s_captureSize - (PHY_DP83825_TRACE_RECORD_SIZE / 2U), &stats) != kStatus_Success);
+    CHECK(stats.exhausted);
+    CHECK(stats.frames == (frames - 1U));
+
+    CHECK(PHY_DP83825_ReplayStart(&s_resource, s_capture, PHY_DP83825_TRACE_HEADER_SIZE - 1U, false, NULL) ==
+          kStatus_InvalidArgument);
+}
+
+int main(void)
+{
+    TEST_ReplayRoundTrip();
+    TEST_ReplayDivergence();
+    TEST_ReplayCount();
+
+    printf("phydp83825_capture_test: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+/*
+ * phydp83825_checkpoint_test.c
+ *
+ *  Checkpoint and restore of the DP83825 PHY driver against the PHY model: a PHY that kept its
+ *  registers is only powered up again, a PHY that was power-cycled gets all of them back, also
+ *  when its configured BMCR is the reset value.
+ */
+
+#include <stdio.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PHY_TEST_ADDR     (1U)
+#define TEST_EEE_ADV      (0x0006U)
+#define TEST_BMCR_DEFAULT (0x3100U)
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static phy_dp83825_sim_bus_t s_bus;
+static phy_dp83825_sim_phy_t s_phy;
+static phy_dp83825_resource_t s_resource;
+static phy_handle_t s_handle;
+static uint32_t s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_Init(bool enableLinkIntr)
+{
+    phy_config_t config = {0};
+
+    PHY_DP83825_SimBusInit(&s_bus, 25U);
+    PHY_DP83825_SimAttach(&s_bus, PHY_TEST_ADDR, &s_phy, DP83825I_PHY_ID);
+    (void)memset(&s_resource, 0, sizeof(s_resource));
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+    config.phyAddr        = PHY_TEST_ADDR;
+    config.resource       = &s_resource;
+    config.ops            = &phydp83825_ops;
+    config.autoNeg        = true;
+    config.enableLinkIntr = enableLinkIntr;
+    config.intrType       = kPHY_IntrActiveLow;
+    CHECK(PHY_Init(&s_handle, &config) == kStatus_Success);
+    s_phy.an[MII_DP83822_EEE_ADV] = TEST_EEE_ADV;
+}
+
+/* The registers restored by a power cycle match the ones before it. */
+static void TEST_CheckRestored(const uint16_t *regs)
+{
+    CHECK(s_phy.regs[MII_DP83822_RCSR] == regs[MII_DP83822_RCSR]);
+    CHECK((s_phy.regs[MII_DP83822_MISR1] & 0x00FFU) == (regs[MII_DP83822_MISR1] & 0x00FFU));
+    CHECK(s_phy.regs[MII_DP83822_PHYSCR] == regs[MII_DP83822_PHYSCR]);
+    CHECK(s_phy.regs[PHY_AUTONEG_ADVERTISE_REG] == regs[PHY_AUTONEG_ADVERTISE_REG]);
+    CHECK(s_phy.regs[PHY_BASICCONTROL_REG] == regs[PHY_BASICCONTROL_REG]);
+    CHECK(s_phy.an[MII_DP83822_EEE_ADV] == TEST_EEE_ADV);
+}
+
+/* A PHY that kept its registers through the power-down is powered up with one write. */
+static void TEST_RestoreKept(void)
+{
+    phy_dp83825_checkpoint_t checkpoint;
+    phy_dp83825_restore_t restore;
+    uint16_t bmcr;
+
+    TEST_Init(true);
+    bmcr = s_phy.regs[PHY_BASICCONTROL_REG];
+    CHECK(PHY_DP83825_Checkpoint(&s_handle, &checkpoint, true) == kStatus_Success);
+    CHECK((s_phy.regs[PHY_BASICCONTROL_REG] & DP83822_BMCR_POWER_DOWN) != 0U);
+    CHECK(PHY_DP83825_Restore(&s_handle, &checkpoint, &restore) == kStatus_Success);
+    CHECK(!restore.lost);
+    CHECK(restore.frames == 3U);
+    CHECK(s_phy.regs[PHY_BASICCONTROL_REG] == bmcr);
+}
+
+/*
+ * BMCR set to its reset value by the application, BMCR alone cannot tell the power cycle. The
+ * enabled interrupt, or without it RCSR, can.
+ */
+static void TEST_RestorePowerCycled(bool enableLinkIntr)
+{
+    phy_dp83825_checkpoint_t checkpoint;
+    phy_dp83825_restore_t restore;
+    uint16_t regs[32];
+
+    TEST_Init(enableLinkIntr);
+    CHECK(PHY_Write(&s_handle, PHY_BASICCONTROL_REG, TEST_BMCR_DEFAULT) == kStatus_Success);
+    (void)memcpy(regs, s_phy.regs, sizeof(regs));
+    CHECK(PHY_DP83825_Checkpoint(&s_handle, &checkpoint, false) == kStatus_Success);
+
+    PHY_DP83825_SimReset(&s_phy);
+    CHECK(PHY_DP83825_Restore(&s_handle, &checkpoint, &restore) == kStatus_Success);
+    CHECK(restore.lost);
+    TEST_CheckRestored(regs);
+    printf("power cycled, link interrupt %s: restored in %u MDIO frames\n", enableLinkIntr ? "on" : "off",
+           restore.frames);
+
+    /* Restored again, the PHY now holds the captured state. */
+    CHECK(PHY_DP83825_Restore(&s_handle, &checkpoint, &restore) == kStatus_Success);
+    CHECK(!restore.lost);
+}
+
+int main(void)
+{
+    TEST_RestoreKept();
+    TEST_RestorePowerCycled(true);
+    TEST_RestorePowerCycled(false);
+
+    printf("phydp83825_checkpoint_test: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
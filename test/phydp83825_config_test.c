@@ -0,0 +1,173 @@
+/*
+ * phydp83825_config_test.c
+ *
+ *  Full configuration of the DP83825 PHY driver against the PHY model: PHY_DP83825_ApplyConfig()
+ *  writes only the registers that change, restarts auto-negotiation only for a new advertisement,
+ *  and writes nothing for the configuration already applied.
+ */
+
+#include <stdio.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PHY_TEST_ADDR   (1U)
+#define TEST_MAX_WRITES (16U)
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+/* One register write as the driver issued it. */
+typedef struct _test_write
+{
+    uint8_t reg;
+    uint16_t value;
+} test_write_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static phy_dp83825_sim_bus_t s_bus;
+static phy_dp83825_sim_phy_t s_phy;
+static phy_dp83825_resource_t s_resource;
+static phy_handle_t s_handle;
+static uint32_t s_failures;
+
+/* Write of the model, the log wraps it. */
+static mdioWrite s_simWrite;
+
+static test_write_t s_writes[TEST_MAX_WRITES];
+static uint32_t s_writeCount;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static status_t TEST_Write(uint8_t phyAddr, uint8_t regAddr, uint16_t data)
+{
+    if (s_writeCount < TEST_MAX_WRITES)
+    {
+        s_writes[s_writeCount].reg   = regAddr;
+        s_writes[s_writeCount].value = data;
+    }
+    s_writeCount++;
+    return s_simWrite(phyAddr, regAddr, data);
+}
+
+static void TEST_Init(phy_dp83825_config_t *current)
+{
+    phy_config_t config = {0};
+
+    PHY_DP83825_SimBusInit(&s_bus, 25U);
+    PHY_DP83825_SimAttach(&s_bus, PHY_TEST_ADDR, &s_phy, DP83825I_PHY_ID);
+    (void)memset(&s_resource, 0, sizeof(s_resource));
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+    config.phyAddr  = PHY_TEST_ADDR;
+    config.resource = &s_resource;
+    config.ops      = &phydp83825_ops;
+    config.autoNeg  = true;
+    CHECK(PHY_Init(&s_handle, &config) == kStatus_Success);
+    CHECK(PHY_DP83825_GetConfig(&s_handle, current) == kStatus_Success);
+
+    /* Only the writes of the tests are logged. */
+    s_simWrite       = s_resource.write;
+    s_resource.write = TEST_Write;
+}
+
+/* Applies config, checks the status and the writes it took. */
+static void TEST_Apply(const phy_dp83825_config_t *config, const test_write_t *expected, uint32_t expectedCount)
+{
+    uint32_t index;
+
+    s_writeCount = 0U;
+    CHECK(PHY_DP83825_ApplyConfig(&s_handle, config) == kStatus_Success);
+    CHECK(s_writeCount == expectedCount);
+    for (index = 0U; (index < s_writeCount) && (index < expectedCount) && (index < TEST_MAX_WRITES); index++)
+    {
+        if ((s_writes[index].reg != expected[index].reg) || (s_writes[index].value != expected[index].value))
+        {
+            printf("write %u: reg 0x%02x 0x%04x, expected reg 0x%02x 0x%04x\n", index, s_writes[index].reg,
+                   s_writes[index].value, expected[index].reg, expected[index].value);
+            s_failures++;
+        }
+    }
+}
+
+/* The interrupt mask and the MDI-X mode only write their registers, the link is left alone. */
+static void TEST_ConfigMinimal(void)
+{
+    phy_dp83825_config_t config;
+    test_write_t expected[2];
+
+    TEST_Init(&config);
+    CHECK(config.interruptMask == 0U);
+    config.interruptMask = DP83822_LINK_STAT_INT_EN;
+    expected[0].reg      = MII_DP83822_MISR1;
+    expected[0].value    = DP83822_LINK_STAT_INT_EN;
+    expected[1].reg      = MII_DP83822_PHYSCR;
+    expected[1].value    = s_phy.regs[MII_DP83822_PHYSCR] | DP83822_PHYSCR_INTEN | DP83822_PHYSCR_INT_OE;
+    TEST_Apply(&config, expected, 2U);
+
+    CHECK(config.mdix == kPHY_DP83825_MdixAuto);
+    config.mdix       = kPHY_DP83825_MdixForced;
+    expected[0].reg   = MII_DP83822_PHYCR;
+    expected[0].value = (uint16_t)((s_phy.regs[MII_DP83822_PHYCR] & ~DP83822_MDIX_AUTO_EN) | DP83822_MDIX_FORCE_CROSS);
+    TEST_Apply(&config, expected, 1U);
+}
+
+/* A new advertisement writes ANAR, then BMCR to restart auto-negotiation with it. */
+static void TEST_ConfigAdvertise(void)
+{
+    phy_dp83825_config_t config;
+    test_write_t expected[2];
+
+    TEST_Init(&config);
+    CHECK(config.autoNeg);
+    config.advertise &= (uint16_t)~PHY_10BASETX_HALFDUPLEX_MASK;
+    expected[0].reg   = PHY_AUTONEG_ADVERTISE_REG;
+    expected[0].value = config.advertise | PHY_IEEE802_3_SELECTOR_MASK;
+    expected[1].reg   = PHY_BASICCONTROL_REG;
+    expected[1].value = s_phy.regs[PHY_BASICCONTROL_REG] | PHY_BCTL_RESTART_AUTONEG_MASK;
+    TEST_Apply(&config, expected, 2U);
+    CHECK(s_phy.regs[PHY_AUTONEG_ADVERTISE_REG] == expected[0].value);
+}
+
+/* The configuration already applied writes nothing, the second time as the first. */
+static void TEST_ConfigUnchanged(void)
+{
+    phy_dp83825_config_t config;
+
+    TEST_Init(&config);
+    TEST_Apply(&config, NULL, 0U);
+
+    config.rcsr ^= DP83822_ELASTICBUF_MASK;
+    config.interruptMask = DP83822_LINK_STAT_INT_EN;
+    config.mdix          = kPHY_DP83825_MdiForced;
+    config.advertise &= (uint16_t)~PHY_10BASETX_FULLDUPLEX_MASK;
+    s_writeCount = 0U;
+    CHECK(PHY_DP83825_ApplyConfig(&s_handle, &config) == kStatus_Success);
+    CHECK(s_writeCount != 0U);
+    TEST_Apply(&config, NULL, 0U);
+}
+
+int main(void)
+{
+    TEST_ConfigMinimal();
+    TEST_ConfigAdvertise();
+    TEST_ConfigUnchanged();
+
+    printf("phydp83825_config_test: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+/*
+ * phydp83825_fiber_test.c
+ *
+ *  DP83822 100BASE-FX fiber mode of the DP83825 PHY driver against the PHY model: the COL strap
+ *  decode, and fiber only on the variant that has it.
+ */
+
+#include <stdio.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PHY_TEST_ADDR (1U)
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static phy_dp83825_sim_bus_t s_bus;
+static phy_dp83825_sim_phy_t s_phy;
+static phy_dp83825_resource_t s_resource;
+static phy_handle_t s_handle;
+static uint32_t s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static status_t TEST_Init(uint32_t phyId, uint16_t colStrap, phy_dp83825_fiber_mode_t fiberMode)
+{
+    phy_config_t config = {0};
+
+    PHY_DP83825_SimBusInit(&s_bus, 25U);
+    PHY_DP83825_SimAttach(&s_bus, PHY_TEST_ADDR, &s_phy, phyId);
+    s_phy.sor1 = (uint16_t)FIELD_PREP(DP83822_COL_STRAP_MASK, colStrap);
+    (void)memset(&s_resource, 0, sizeof(s_resource));
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+    s_resource.fiberMode = fiberMode;
+    config.phyAddr       = PHY_TEST_ADDR;
+    config.resource      = &s_resource;
+    config.ops           = &phydp83825_ops;
+    config.autoNeg       = true;
+    return PHY_Init(&s_handle, &config);
+}
+
+/* Modes 2 and 3 of the COL strap select 100BASE-FX, modes 1 and 4 copper. */
+static void TEST_FiberStrap(void)
+{
+    static const uint16_t straps[] = {DP83822_STRAP_MODE1, DP83822_STRAP_MODE2, DP83822_STRAP_MODE3,
+                                      DP83822_STRAP_MODE4};
+    static const bool fiber[]      = {false, true, true, false};
+    uint32_t index;
+
+    for (index = 0U; index < (sizeof(straps) / sizeof(straps[0])); index++)
+    {
+        CHECK(TEST_Init(DP83822_PHY_ID, straps[index], kPHY_DP83825_FiberStrap) == kStatus_Success);
+        CHECK(PHY_DP83825_IsFiber(&s_handle) == fiber[index]);
+    }
+}
+
+/* Only the DP83822 has a fiber mode, the straps of the others are not decoded. */
+static void TEST_FiberVariant(void)
+{
+    CHECK(TEST_Init(DP83822_PHY_ID, DP83822_STRAP_MODE1, kPHY_DP83825_FiberOn) == kStatus_Success);
+    CHECK(PHY_DP83825_IsFiber(&s_handle));
+    CHECK(TEST_Init(DP83825I_PHY_ID, DP83822_STRAP_MODE1, kPHY_DP83825_FiberOn) == kStatus_InvalidArgument);
+    CHECK(TEST_Init(DP83825I_PHY_ID, DP83822_STRAP_MODE2, kPHY_DP83825_FiberStrap) == kStatus_Success);
+    CHECK(!PHY_DP83825_IsFiber(&s_handle));
+}
+
+int main(void)
+{
+    TEST_FiberStrap();
+    TEST_FiberVariant();
+
+    printf("phydp83825_fiber_test: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,299 @@
+/*
+ * phydp83825_lwip_test.c
+ *
+ *  lwIP glue of the DP83825 PHY driver against the PHY model: the INT edge reaches the netif
+ *  through the tcpip thread, with the event to netif latency of each link change, and an interrupt
+ *  that finds the tcpip mailbox full is still handled.
+ *
+ *  The tcpip thread is modelled by TEST_TcpipRun(), which empties the mailbox and runs the expired
+ *  timeouts, in the simulated time of the PHY model.
+ */
+
+#include <stdio.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_lwip.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PHY_TEST_ADDR    (1U)
+#define TEST_MBOX_SIZE   (8U)
+#define TEST_TIMEOUTS    (8U)
+#define TEST_LINK_EVENTS (200U)
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+struct tcpip_callback_msg
+{
+    tcpip_callback_fn function;
+    void *ctx;
+};
+
+typedef struct _test_timeout
+{
+    sys_timeout_handler handler;
+    void *arg;
+    uint32_t dueUs;
+} test_timeout_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static phy_dp83825_sim_bus_t s_bus;
+static phy_dp83825_sim_phy_t s_phy;
+static phy_dp83825_resource_t s_resource;
+static phy_handle_t s_handle;
+static phy_dp83825_netif_t s_glue;
+static struct netif s_netif;
+static uint32_t s_failures;
+
+static struct tcpip_callback_msg s_mbox[TEST_MBOX_SIZE];
+static uint32_t s_mboxCount;
+static uint32_t s_mboxSize = TEST_MBOX_SIZE;
+static struct tcpip_callback_msg s_msg;
+static test_timeout_t s_timeouts[TEST_TIMEOUTS];
+
+/* Time of the last link change on the line and of the last netif update. */
+static uint32_t s_eventUs;
+static uint32_t s_netifUs;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void netif_set_link_up(struct netif *netif)
+{
+    netif->linkUp = 1U;
+    netif->linkChanges++;
+    s_netifUs = PHY_DP83825_SimTimeUs();
+}
+
+void netif_set_link_down(struct netif *netif)
+{
+    netif->linkUp = 0U;
+    netif->linkChanges++;
+    s_netifUs = PHY_DP83825_SimTimeUs();
+}
+
+static err_t TEST_MboxPost(tcpip_callback_fn function, void *ctx)
+{
+    if (s_mboxCount >= s_mboxSize)
+    {
+        return ERR_MEM;
+    }
+    s_mbox[s_mboxCount].function = function;
+    s_mbox[s_mboxCount].ctx      = ctx;
+    s_mboxCount++;
+    return ERR_OK;
+}
+
+err_t tcpip_callback(tcpip_callback_fn function, void *ctx)
+{
+    return TEST_MboxPost(function, ctx);
+}
+
+struct tcpip_callback_msg *tcpip_callbackmsg_new(tcpip_callback_fn function, void *ctx)
+{
+    s_msg.function = function;
+    s_msg.ctx      = ctx;
+    return &s_msg;
+}
+
+void tcpip_callbackmsg_delete(struct tcpip_callback_msg *msg)
+{
+    (void)memset(msg, 0, sizeof(*msg));
+}
+
+err_t tcpip_callbackmsg_trycallback(struct tcpip_callback_msg *msg)
+{
+    return TEST_MboxPost(msg->function, msg->ctx);
+}
+
+err_t tcpip_callbackmsg_trycallback_fromisr(struct tcpip_callback_msg *msg)
+{
+    return TEST_MboxPost(msg->function, msg->ctx);
+}
+
+void sys_timeout(uint32_t msecs, sys_timeout_handler handler, void *arg)
+{
+    uint32_t index;
+
+    for (index = 0U; index < TEST_TIMEOUTS; index++)
+    {
+        if (s_timeouts[index].handler == NULL)
+        {
+            s_timeouts[index].handler = handler;
+            s_timeouts[index].arg     = arg;
+            s_timeouts[index].dueUs   = PHY_DP83825_SimTimeUs() + (msecs * 1000U);
+            return;
+        }
+    }
+    CHECK(false);
+}
+
+void sys_untimeout(sys_timeout_handler handler, void *arg)
+{
+    uint32_t index;
+
+    for (index = 0U; index < TEST_TIMEOUTS; index++)
+    {
+        if ((s_timeouts[index].handler == handler) && (s_timeouts[index].arg == arg))
+        {
+            s_timeouts[index].handler = NULL;
+        }
+    }
+}
+
+/* One round of the tcpip thread: the queued messages, then the expired timeouts. */
+static void TEST_TcpipRun(void)
+{
+    struct tcpip_callback_msg msg;
+    sys_timeout_handler handler;
+    uint32_t index;
+
+    while (s_mboxCount != 0U)
+    {
+        msg = s_mbox[0];
+        s_mboxCount--;
+        (void)memmove(&s_mbox[0], &s_mbox[1], s_mboxCount * sizeof(s_mbox[0]));
+        msg.function(msg.ctx);
+    }
+    for (index = 0U; index < TEST_TIMEOUTS; index++)
+    {
+        handler = s_timeouts[index].handler;
+        if ((handler != NULL) && ((int32_t)(PHY_DP83825_SimTimeUs() - s_timeouts[index].dueUs) >= 0))
+        {
+            s_timeouts[index].handler = NULL;
+            handler(s_timeouts[index].arg);
+        }
+    }
+}
+
+/* The INT pin, as an edge interrupt. */
+static void TEST_PhyIrq(void *context)
+{
+    PHY_DP83825_NetifIRQHandler((phy_dp83825_netif_t *)context);
+}
+
+static void TEST_SetLink(bool up)
+{
+    s_eventUs = PHY_DP83825_SimTimeUs();
+    PHY_DP83825_SimSetLink(&s_phy, up, kPHY_Speed100M, kPHY_FullDuplex);
+}
+
+static void TEST_Init(void)
+{
+    phy_config_t config = {0};
+
+    PHY_DP83825_SimBusInit(&s_bus, 25U);
+    PHY_DP83825_SimAttach(&s_bus, PHY_TEST_ADDR, &s_phy, DP83825I_PHY_ID);
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+    config.phyAddr        = PHY_TEST_ADDR;
+    config.resource       = &s_resource;
+    config.ops            = &phydp83825_ops;
+    config.autoNeg        = true;
+    config.enableLinkIntr = true;
+    config.intrType       = kPHY_IntrActiveLow;
+    CHECK(PHY_Init(&s_handle, &config) == kStatus_Success);
+
+    s_phy.irq        = TEST_PhyIrq;
+    s_phy.irqContext = &s_glue;
+    CHECK(PHY_DP83825_NetifInit(&s_glue, &s_netif, &s_handle, NULL, NULL) == kStatus_Success);
+    TEST_TcpipRun();
+    CHECK(s_netif.linkUp == 0U);
+}
+
+/* Each link change reaches the netif in one pass of the tcpip thread. */
+static void TEST_NetifLatency(void)
+{
+    phy_dp83825_netif_stats_t stats;
+    uint32_t totalUs = 0U;
+    uint32_t maxUs   = 0U;
+    uint32_t latencyUs;
+    uint32_t event;
+
+    for (event = 0U; event < TEST_LINK_EVENTS; event++)
+    {
+        TEST_SetLink((event & 1U) == 0U);
+        CHECK(s_phy.intAsserted);
+        TEST_TcpipRun();
+        CHECK(s_netif.linkUp == (((event & 1U) == 0U) ? 1U : 0U));
+        CHECK(!s_phy.intAsserted);
+
+        latencyUs = s_netifUs - s_eventUs;
+        totalUs += latencyUs;
+        maxUs = (latencyUs > maxUs) ? latencyUs : maxUs;
+        PHY_DP83825_SimDelayUs(1000U);
+    }
+
+    PHY_DP83825_NetifGetStats(&s_glue, &stats);
+    CHECK(stats.linkChanges == TEST_LINK_EVENTS);
+    CHECK(stats.dropped == 0U);
+    CHECK(stats.maxLatencyUs == maxUs);
+    printf("event to netif latency: %u link changes, average %u us, max %u us, %u MDIO frames of %u us\n",
+           TEST_LINK_EVENTS, totalUs / TEST_LINK_EVENTS, maxUs, (maxUs + s_bus.frameUs - 1U) / s_bus.frameUs,
+           s_bus.frameUs);
+}
+
+/*
+ * An interrupt finding the mailbox full leaves INT asserted, later link changes give no edge. The
+ * retry timer has to pick the state up.
+ */
+static void TEST_NetifMailboxFull(void)
+{
+    phy_dp83825_netif_stats_t stats;
+    uint32_t waitedUs;
+
+    CHECK(s_netif.linkUp == 0U);
+    s_mboxSize = 0U;
+    TEST_SetLink(true);
+    CHECK(s_phy.intAsserted);
+    PHY_DP83825_NetifGetStats(&s_glue, &stats);
+    CHECK(stats.dropped == 1U);
+
+    /* No further edge while INT is asserted, the mailbox has room again. */
+    s_mboxSize = TEST_MBOX_SIZE;
+    PHY_DP83825_SimSetLink(&s_phy, false, kPHY_Speed100M, kPHY_FullDuplex);
+    PHY_DP83825_SimSetLink(&s_phy, true, kPHY_Speed100M, kPHY_FullDuplex);
+    CHECK(s_mboxCount == 0U);
+
+    for (waitedUs = 0U; (s_netif.linkUp == 0U) && (waitedUs < (2U * PHY_DP83825_NETIF_RETRY_MS * 1000U));
+         waitedUs += 1000U)
+    {
+        PHY_DP83825_SimDelayUs(1000U);
+        TEST_TcpipRun();
+    }
+    CHECK(s_netif.linkUp == 1U);
+    CHECK(!s_phy.intAsserted);
+    CHECK((s_netifUs - s_eventUs) <= ((PHY_DP83825_NETIF_RETRY_MS + 1U) * 1000U));
+    printf("mailbox full: netif updated %u us after the event, retry period %u ms\n", s_netifUs - s_eventUs,
+           PHY_DP83825_NETIF_RETRY_MS);
+
+    /* Edges work again. */
+    TEST_SetLink(false);
+    TEST_TcpipRun();
+    CHECK(s_netif.linkUp == 0U);
+}
+
+int main(void)
+{
+    TEST_Init();
+    TEST_NetifLatency();
+    TEST_NetifMailboxFull();
+    PHY_DP83825_NetifDeinit(&s_glue);
+
+    printf("phydp83825_lwip_test: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
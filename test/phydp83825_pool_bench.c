@@ -0,0 +1,191 @@
+/*
+ * phydp83825_pool_bench.c
+ *
+ *  Bus scaling of the DP83825 PHY pool against the PHY model: the PHYs of the pool spread over
+ *  1, 2 and 4 MDIO buses, each bus with its lock and its own task polling the PHYs on it. The frames
+ *  take their real duration, the same polls finish faster the more buses share them.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_pool.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_BUSES_MAX (4U)
+#define TEST_PHYS      (PHY_DP83825_POOL_SIZE)
+#define TEST_POLLS     (100U)
+#define TEST_FRAME_US  (25U)
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+/* One bus with its lock and its task. */
+typedef struct _test_bus
+{
+    phy_dp83825_sim_bus_t sim;
+    phy_dp83825_bus_t bus;
+    pthread_mutex_t mutex;
+    pthread_t task;
+    uint32_t locks;
+    uint32_t errors;
+} test_bus_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static test_bus_t s_buses[TEST_BUSES_MAX];
+static phy_dp83825_sim_phy_t s_phys[TEST_PHYS];
+static uint32_t s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_Lock(void *lockContext)
+{
+    test_bus_t *bus = (test_bus_t *)lockContext;
+
+    (void)pthread_mutex_lock(&bus->mutex);
+    bus->locks++;
+}
+
+static void TEST_Unlock(void *lockContext)
+{
+    (void)pthread_mutex_unlock(&((test_bus_t *)lockContext)->mutex);
+}
+
+/* The task of a bus, polls the link of every PHY on it. */
+static void *TEST_BusTask(void *arg)
+{
+    test_bus_t *bus = (test_bus_t *)arg;
+    phy_dp83825_instance_t *instance;
+    uint32_t poll;
+    uint8_t addr;
+    bool up;
+
+    for (poll = 0U; poll < TEST_POLLS; poll++)
+    {
+        for (addr = 0U; addr < TEST_PHYS; addr++)
+        {
+            instance = PHY_DP83825_PoolFind(bus->bus.busId, addr);
+            if (instance == NULL)
+            {
+                continue;
+            }
+            if ((PHY_GetLinkStatus(&instance->handle, &up) != kStatus_Success) || (up != ((addr & 1U) != 0U)))
+            {
+                bus->errors++;
+            }
+        }
+    }
+    return NULL;
+}
+
+/* Opens the PHYs of the pool on buses, PHY n on bus n modulo buses, and times the polls. */
+static uint32_t TEST_Run(uint32_t buses, uint32_t *frames)
+{
+    phy_dp83825_resource_t resource = {0};
+    phy_dp83825_instance_t *instances[TEST_PHYS];
+    phy_config_t config = {0};
+    uint32_t startUs;
+    uint32_t index;
+    uint8_t addr;
+
+    /* Bring-up in simulated time, only the polls are timed. */
+    PHY_DP83825_SimSetRealTime(false);
+    resource.getTimeUs = PHY_DP83825_SimTimeUs;
+    resource.delayUs   = PHY_DP83825_SimDelayUs;
+    config.resource    = &resource;
+    config.ops         = &phydp83825_ops;
+    config.autoNeg     = true;
+    for (index = 0U; index < buses; index++)
+    {
+        PHY_DP83825_SimBusInit(&s_buses[index].sim, TEST_FRAME_US);
+        PHY_DP83825_SimBusBind(&s_buses[index].bus, &s_buses[index].sim, (uint8_t)index);
+        s_buses[index].bus.lock        = TEST_Lock;
+        s_buses[index].bus.unlock      = TEST_Unlock;
+        s_buses[index].bus.lockContext = &s_buses[index];
+        s_buses[index].locks           = 0U;
+        s_buses[index].errors          = 0U;
+    }
+    for (addr = 0U; addr < TEST_PHYS; addr++)
+    {
+        PHY_DP83825_SimAttach(&s_buses[addr % buses].sim, addr, &s_phys[addr], DP83825I_PHY_ID);
+        config.phyAddr = addr;
+        CHECK(PHY_DP83825_PoolOpen(&s_buses[addr % buses].bus, &config, &instances[addr]) == kStatus_Success);
+        PHY_DP83825_SimSetLink(&s_phys[addr], (addr & 1U) != 0U, kPHY_Speed100M, kPHY_FullDuplex);
+    }
+
+    PHY_DP83825_SimSetRealTime(true);
+    startUs = PHY_DP83825_SimTimeUs();
+    for (index = 0U; index < buses; index++)
+    {
+        s_buses[index].sim.frames = 0U;
+        CHECK(pthread_create(&s_buses[index].task, NULL, TEST_BusTask, &s_buses[index]) == 0);
+    }
+    *frames = 0U;
+    for (index = 0U; index < buses; index++)
+    {
+        CHECK(pthread_join(s_buses[index].task, NULL) == 0);
+        CHECK(s_buses[index].errors == 0U);
+        CHECK(s_buses[index].locks >= s_buses[index].sim.frames);
+        *frames += s_buses[index].sim.frames;
+    }
+    startUs = PHY_DP83825_SimTimeUs() - startUs;
+
+    for (addr = 0U; addr < TEST_PHYS; addr++)
+    {
+        if (instances[addr] != NULL)
+        {
+            PHY_DP83825_PoolClose(instances[addr]);
+        }
+    }
+    return startUs;
+}
+
+int main(void)
+{
+    uint32_t buses;
+    uint32_t frames;
+    uint32_t elapsedUs;
+    uint32_t singleUs = 0U;
+    uint32_t index;
+
+    for (index = 0U; index < TEST_BUSES_MAX; index++)
+    {
+        (void)pthread_mutex_init(&s_buses[index].mutex, NULL);
+    }
+
+    printf("%u PHYs, %u link polls each, MDIO frames of %u us\n", TEST_PHYS, TEST_POLLS, TEST_FRAME_US);
+    for (buses = 1U; buses <= TEST_BUSES_MAX; buses *= 2U)
+    {
+        elapsedUs = TEST_Run(buses, &frames);
+        singleUs  = (buses == 1U) ? elapsedUs : singleUs;
+        printf("%u bus(es): %6u frames in %7u us, %6u frames/s, speedup %.2f\n", buses, frames, elapsedUs,
+               (uint32_t)(((uint64_t)frames * 1000000U) / elapsedUs), (double)singleUs / elapsedUs);
+
+        /* The buses run in parallel, allow for the scheduling of the sleeping tasks. */
+        CHECK(((uint64_t)elapsedUs * buses) < ((uint64_t)singleUs * 2U));
+    }
+
+    for (index = 0U; index < TEST_BUSES_MAX; index++)
+    {
+        (void)pthread_mutex_destroy(&s_buses[index].mutex);
+    }
+    printf("phydp83825_pool_bench: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+/*
+ * phydp83825_regfield_check.cpp
+ *
+ *  Build checks of the typed register fields in regfield.h and fsl_phydp83825_regs.h, no test to
+ *  run. Built with TEST_TYPED the functions use the typed fields, without it the raw masks and
+ *  FIELD_* macros; both builds must give the same code. Each TEST_FAIL_* misuses the fields and
+ *  must not build.
+ */
+
+#include "fsl_phydp83825.h"
+#include "fsl_phydp83825_regs.h"
+
+using namespace dp83825;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* BMCR forced to speed and duplex, as dp83825::async::Phy::reconfigure() does. */
+uint16_t TEST_ForceBmcr(uint16_t bmcr, phy_speed_t speed, phy_duplex_t duplex)
+{
+#if defined(TEST_TYPED)
+    return (BMCR_ISOLATE::set<0U>() | BMCR_AUTONEG::set<0U>() | BMCR_SPEED::prep((speed == kPHY_Speed100M) ? 1U : 0U) |
+            BMCR_DUPLEX::prep((duplex == kPHY_FullDuplex) ? 1U : 0U))
+        .apply(bmcr);
+#else
+    return (uint16_t)((bmcr & (uint16_t)~(PHY_BCTL_ISOLATE_MASK | PHY_BCTL_AUTONEG_MASK | PHY_BCTL_SPEED0_MASK |
+                                          PHY_BCTL_DUPLEX_MASK)) |
+                      ((speed == kPHY_Speed100M) ? PHY_BCTL_SPEED0_MASK : 0U) |
+                      ((duplex == kPHY_FullDuplex) ? PHY_BCTL_DUPLEX_MASK : 0U));
+#endif
+}
+
+/* The same update as a script entry. */
+phy_dp83825_script_t TEST_ForceScript(phy_speed_t speed, phy_duplex_t duplex)
+{
+#if defined(TEST_TYPED)
+    return script(BMCR_ISOLATE::set<0U>() | BMCR_AUTONEG::set<0U>() |
+                  BMCR_SPEED::prep((speed == kPHY_Speed100M) ? 1U : 0U) |
+                  BMCR_DUPLEX::prep((duplex == kPHY_FullDuplex) ? 1U : 0U));
+#else
+    return PHY_DP83825_SCRIPT_MODIFY(
+        PHY_BASICCONTROL_REG,
+        PHY_BCTL_ISOLATE_MASK | PHY_BCTL_AUTONEG_MASK | PHY_BCTL_SPEED0_MASK | PHY_BCTL_DUPLEX_MASK,
+        (uint16_t)(((speed == kPHY_Speed100M) ? PHY_BCTL_SPEED0_MASK : 0U) |
+                   ((duplex == kPHY_FullDuplex) ? PHY_BCTL_DUPLEX_MASK : 0U)));
+#endif
+}
+
+/* Three run time fields of one register folded into one update. */
+uint16_t TEST_VodCfg2(uint16_t cfg2, uint16_t minusMdix, uint16_t plusMdix, uint16_t plusMdi)
+{
+#if defined(TEST_TYPED)
+    return (VOD_CFG2_MINUS_MDIX::prep(minusMdix) | VOD_CFG2_PLUS_MDIX::prep(plusMdix) |
+            VOD_CFG2_PLUS_MDI::prep(plusMdi))
+        .apply(cfg2);
+#else
+    return (uint16_t)FIELD_MODIFY(
+        DP83826_VOD_CFG2_PLUS_MDI_MASK,
+        FIELD_MODIFY(DP83826_VOD_CFG2_PLUS_MDIX_MASK, FIELD_MODIFY(DP83826_VOD_CFG2_MINUS_MDIX_MASK, cfg2, minusMdix),
+                     plusMdix),
+        plusMdi);
+#endif
+}
+
+/* Constant fields fold into a constant entry. */
+phy_dp83825_script_t TEST_WolScript(void)
+{
+#if defined(TEST_TYPED)
+    return script(WOL_EN::set<1U>() | WOL_MAGIC_EN::set<1U>() | WOL_SECURE_ON::set<0U>());
+#else
+    return PHY_DP83825_SCRIPT_EXT_MODIFY(MII_DP83822_WOL_CFG,
+                                         DP83822_WOL_EN | DP83822_WOL_MAGIC_EN | DP83822_WOL_SECURE_ON,
+                                         DP83822_WOL_EN | DP83822_WOL_MAGIC_EN);
+#endif
+}
+
+#if defined(TEST_FAIL_REGISTERS)
+/* A BMCR field and an ANAR field are not one update. */
+phy_dp83825_script_t TEST_FailRegisters(void)
+{
+    return script(BMCR_AUTONEG::set<1U>() | ANAR_PAUSE::set<1U>());
+}
+#endif
+
+#if defined(TEST_FAIL_VALUE)
+/* 2 does not fit the one bit speed field. */
+phy_dp83825_script_t TEST_FailValue(void)
+{
+    return script(BMCR_SPEED::set<2U>());
+}
+#endif
+
+#if defined(TEST_FAIL_WIDTH)
+/* Bit 16 is not in a 16-bit register. */
+uint16_t TEST_FailWidth(void)
+{
+    return regfield::Field<BMCR, 16U, 0U>::mask;
+}
+#endif
@@ -0,0 +1,223 @@
+/*
+ * phydp83825_retry_test.c
+ *
+ *  MDIO retry policy of the DP83825 PHY driver against the PHY model, with injected faults: dropped
+ *  frames, frames slower than the frame timeout and MDIO stuck high. Checks the retries, the capped
+ *  backoff and that a call never runs past its deadline by more than one frame.
+ */
+
+#include <stdio.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PHY_TEST_ADDR   (1U)
+#define TEST_FRAME_US   (25U)
+#define TEST_MAX_DELAYS (300U)
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static phy_dp83825_sim_bus_t s_bus;
+static phy_dp83825_sim_phy_t s_phy;
+static phy_dp83825_resource_t s_resource;
+static phy_handle_t s_handle;
+static uint32_t s_failures;
+
+/* Backoff delays of the driver, in order. */
+static uint32_t s_delays[TEST_MAX_DELAYS];
+static uint32_t s_delayCount;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_DelayUs(uint32_t delayUs)
+{
+    if (s_delayCount < TEST_MAX_DELAYS)
+    {
+        s_delays[s_delayCount] = delayUs;
+    }
+    s_delayCount++;
+    PHY_DP83825_SimDelayUs(delayUs);
+}
+
+static void TEST_Init(void)
+{
+    phy_config_t config = {0};
+
+    PHY_DP83825_SimBusInit(&s_bus, TEST_FRAME_US);
+    PHY_DP83825_SimAttach(&s_bus, PHY_TEST_ADDR, &s_phy, DP83825I_PHY_ID);
+    (void)memset(&s_resource, 0, sizeof(s_resource));
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+    config.phyAddr  = PHY_TEST_ADDR;
+    config.resource = &s_resource;
+    config.ops      = &phydp83825_ops;
+    config.autoNeg  = true;
+    CHECK(PHY_Init(&s_handle, &config) == kStatus_Success);
+    s_resource.delayUs = TEST_DelayUs;
+}
+
+/* One read of PHYIDR1 under policy, returns the statistics it added. */
+static status_t TEST_Read(const phy_dp83825_retry_policy_t *policy, phy_dp83825_retry_stats_t *stats, uint32_t *timeUs)
+{
+    phy_dp83825_retry_stats_t before;
+    uint32_t startUs;
+    uint16_t value = 0U;
+    status_t result;
+
+    PHY_DP83825_SetRetryPolicy(&s_handle, policy);
+    PHY_DP83825_GetRetryStats(&s_handle, &before);
+    s_delayCount = 0U;
+    startUs      = PHY_DP83825_SimTimeUs();
+    result       = PHY_Read(&s_handle, PHY_ID1_REG, &value);
+    *timeUs      = PHY_DP83825_SimTimeUs() - startUs;
+    PHY_DP83825_GetRetryStats(&s_handle, stats);
+    stats->frames -= before.frames;
+    stats->retries -= before.retries;
+    stats->timeouts -= before.timeouts;
+    stats->failures -= before.failures;
+    stats->deadlines -= before.deadlines;
+    if (result == kStatus_Success)
+    {
+        CHECK(value == (uint16_t)(DP83825I_PHY_ID >> 16U));
+    }
+    return result;
+}
+
+/* Dropped frames are retried, the backoff doubles up to maxBackoffUs. */
+static void TEST_RetryDropped(void)
+{
+    phy_dp83825_retry_policy_t policy = {0};
+    phy_dp83825_retry_stats_t stats;
+    uint32_t timeUs;
+
+    policy.backoffUs    = 100U;
+    policy.maxBackoffUs = 400U;
+    policy.maxRetries   = 5U;
+    s_bus.failFrames    = 4U;
+    CHECK(TEST_Read(&policy, &stats, &timeUs) == kStatus_Success);
+    CHECK(stats.frames == 5U);
+    CHECK(stats.retries == 4U);
+    CHECK(stats.timeouts == 4U);
+    CHECK(stats.failures == 0U);
+    CHECK(s_delayCount == 4U);
+    CHECK((s_delays[0] == 100U) && (s_delays[1] == 200U) && (s_delays[2] == 400U) && (s_delays[3] == 400U));
+    CHECK(timeUs == ((5U * TEST_FRAME_US) + 1100U));
+
+    /* More drops than retries, the frame is given up. */
+    s_bus.failFrames = 10U;
+    CHECK(TEST_Read(&policy, &stats, &timeUs) == kStatus_Timeout);
+    CHECK(stats.frames == 6U);
+    CHECK(stats.retries == 5U);
+    CHECK(stats.failures == 1U);
+    s_bus.failFrames = 0U;
+}
+
+/* Frames answering after opTimeoutUs count as timed out and are retried. */
+static void TEST_RetrySlow(void)
+{
+    phy_dp83825_retry_policy_t policy = {0};
+    phy_dp83825_retry_stats_t stats;
+    uint32_t timeUs;
+
+    policy.opTimeoutUs = 200U;
+    policy.backoffUs   = 50U;
+    policy.maxRetries  = 3U;
+    s_bus.slowFrames   = 2U;
+    s_bus.slowUs       = 500U;
+    CHECK(TEST_Read(&policy, &stats, &timeUs) == kStatus_Success);
+    CHECK(stats.frames == 3U);
+    CHECK(stats.retries == 2U);
+    CHECK(stats.timeouts == 2U);
+    CHECK((s_delays[0] == 50U) && (s_delays[1] == 100U));
+}
+
+/* Reads answering 0xFFFF are failed frames with retryStuckHigh, and valid data without it. */
+static void TEST_RetryStuckHigh(void)
+{
+    phy_dp83825_retry_policy_t policy = {0};
+    phy_dp83825_retry_stats_t stats;
+    uint32_t timeUs;
+    uint16_t value;
+
+    policy.backoffUs      = 10U;
+    policy.maxRetries     = 4U;
+    policy.retryStuckHigh = true;
+    s_bus.stuckHighFrames = 3U;
+    CHECK(TEST_Read(&policy, &stats, &timeUs) == kStatus_Success);
+    CHECK(stats.frames == 4U);
+    CHECK(stats.retries == 3U);
+    CHECK(stats.timeouts == 0U);
+
+    policy.retryStuckHigh = false;
+    PHY_DP83825_SetRetryPolicy(&s_handle, &policy);
+    s_bus.stuckHighFrames = 1U;
+    CHECK(PHY_Read(&s_handle, PHY_ID1_REG, &value) == kStatus_Success);
+    CHECK(value == 0xFFFFU);
+}
+
+/*
+ * A bus failing for good under a deadline: the backoff saturates at maxBackoffUs, the last sleep is
+ * cut to the deadline and the call returns within the deadline plus one frame.
+ */
+static void TEST_RetryDeadline(void)
+{
+    phy_dp83825_retry_policy_t policy = {0};
+    phy_dp83825_retry_stats_t stats;
+    uint32_t totalUs = 0U;
+    uint32_t timeUs;
+    uint32_t index;
+
+    policy.backoffUs      = 100U;
+    policy.maxBackoffUs   = 1000U;
+    policy.callDeadlineUs = 5000U;
+    policy.maxRetries     = 255U;
+    s_bus.failFrames      = UINT32_MAX;
+    CHECK(TEST_Read(&policy, &stats, &timeUs) == kStatus_Timeout);
+    s_bus.failFrames = 0U;
+
+    CHECK(stats.deadlines == 1U);
+    CHECK(stats.failures == 1U);
+    CHECK(stats.retries < 255U);
+    CHECK(timeUs <= (policy.callDeadlineUs + TEST_FRAME_US));
+    for (index = 0U; (index < s_delayCount) && (index < TEST_MAX_DELAYS); index++)
+    {
+        CHECK(s_delays[index] <= policy.maxBackoffUs);
+        totalUs += s_delays[index];
+    }
+    CHECK(s_delays[4] == policy.maxBackoffUs);
+    CHECK(totalUs < policy.callDeadlineUs);
+    printf("deadline %u us: %u retries, %u backoffs, returned after %u us\n", policy.callDeadlineUs, stats.retries,
+           s_delayCount, timeUs);
+
+    (void)memset(&policy, 0, sizeof(policy));
+    PHY_DP83825_SetRetryPolicy(&s_handle, &policy);
+}
+
+int main(void)
+{
+    TEST_Init();
+    TEST_RetryDropped();
+    TEST_RetrySlow();
+    TEST_RetryStuckHigh();
+    TEST_RetryDeadline();
+
+    printf("phydp83825_retry_test: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,281 @@
+/*
+ * phydp83825_script_test.c
+ *
+ *  Register scripts of the DP83825 PHY driver against the PHY model, frame by frame: the folding of
+ *  write/modify runs on one register, the modify skipped when it changes nothing, the wait timing
+ *  out, the entries skipped by a PHY ID condition and extended entries never folded with basic ones.
+ */
+
+#include <stdio.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PHY_TEST_ADDR   (1U)
+#define TEST_REG        (MII_DP83822_PHYCR)
+#define TEST_MAX_FRAMES (32U)
+
+#define TEST_READ  (0U)
+#define TEST_WRITE (1U)
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+/* One MDIO access as the driver issued it, devAddr 0 for the basic registers. */
+typedef struct _test_frame
+{
+    uint8_t op;
+    uint8_t devAddr;
+    uint16_t reg;
+    uint16_t value;
+} test_frame_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static phy_dp83825_sim_bus_t s_bus;
+static phy_dp83825_sim_phy_t s_phy;
+static phy_dp83825_resource_t s_resource;
+static phy_handle_t s_handle;
+static uint32_t s_failures;
+
+/* Accesses of the model, the log wraps them. */
+static mdioWrite s_simWrite;
+static mdioRead s_simRead;
+static mdioWriteExt s_simWriteExt;
+static mdioReadExt s_simReadExt;
+
+static test_frame_t s_frames[TEST_MAX_FRAMES];
+static uint32_t s_frameCount;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_Log(uint8_t op, uint8_t devAddr, uint16_t reg, uint16_t value)
+{
+    if (s_frameCount < TEST_MAX_FRAMES)
+    {
+        s_frames[s_frameCount].op      = op;
+        s_frames[s_frameCount].devAddr = devAddr;
+        s_frames[s_frameCount].reg     = reg;
+        s_frames[s_frameCount].value   = value;
+    }
+    s_frameCount++;
+}
+
+static status_t TEST_Write(uint8_t phyAddr, uint8_t regAddr, uint16_t data)
+{
+    TEST_Log(TEST_WRITE, 0U, regAddr, data);
+    return s_simWrite(phyAddr, regAddr, data);
+}
+
+static status_t TEST_Read(uint8_t phyAddr, uint8_t regAddr, uint16_t *pData)
+{
+    status_t result = s_simRead(phyAddr, regAddr, pData);
+
+    TEST_Log(TEST_READ, 0U, regAddr, *pData);
+    return result;
+}
+
+static status_t TEST_WriteExt(uint8_t portAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data)
+{
+    TEST_Log(TEST_WRITE, devAddr, regAddr, data);
+    return s_simWriteExt(portAddr, devAddr, regAddr, data);
+}
+
+static status_t TEST_ReadExt(uint8_t portAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData)
+{
+    status_t result = s_simReadExt(portAddr, devAddr, regAddr, pData);
+
+    TEST_Log(TEST_READ, devAddr, regAddr, *pData);
+    return result;
+}
+
+static void TEST_Init(void)
+{
+    phy_config_t config = {0};
+
+    PHY_DP83825_SimBusInit(&s_bus, 25U);
+    PHY_DP83825_SimAttach(&s_bus, PHY_TEST_ADDR, &s_phy, DP83825I_PHY_ID);
+    (void)memset(&s_resource, 0, sizeof(s_resource));
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+    config.phyAddr  = PHY_TEST_ADDR;
+    config.resource = &s_resource;
+    config.ops      = &phydp83825_ops;
+    config.autoNeg  = true;
+    CHECK(PHY_Init(&s_handle, &config) == kStatus_Success);
+
+    /* Only the scripts of the tests are logged. */
+    s_simWrite          = s_resource.write;
+    s_simRead           = s_resource.read;
+    s_simWriteExt       = s_resource.writeExt;
+    s_simReadExt        = s_resource.readExt;
+    s_resource.write    = TEST_Write;
+    s_resource.read     = TEST_Read;
+    s_resource.writeExt = TEST_WriteExt;
+    s_resource.readExt  = TEST_ReadExt;
+}
+
+/* Runs script from a register value, checks the status and the frames it took. */
+static void TEST_Run(const phy_dp83825_script_t *script,
+                     uint32_t count,
+                     uint16_t regValue,
+                     status_t status,
+                     const test_frame_t *expected,
+                     uint32_t expectedCount)
+{
+    uint32_t index;
+
+    s_phy.regs[TEST_REG] = regValue;
+    s_frameCount         = 0U;
+    CHECK(PHY_DP83825_RunScript(&s_handle, script, count) == status);
+    CHECK(s_frameCount == expectedCount);
+    for (index = 0U; (index < s_frameCount) && (index < expectedCount) && (index < TEST_MAX_FRAMES); index++)
+    {
+        if ((s_frames[index].op != expected[index].op) || (s_frames[index].devAddr != expected[index].devAddr) ||
+            (s_frames[index].reg != expected[index].reg) || (s_frames[index].value != expected[index].value))
+        {
+            printf("frame %u: %c dev 0x%02x reg 0x%02x 0x%04x, expected %c dev 0x%02x reg 0x%02x 0x%04x\n", index,
+                   (s_frames[index].op == TEST_WRITE) ? 'W' : 'R', s_frames[index].devAddr, s_frames[index].reg,
+                   s_frames[index].value, (expected[index].op == TEST_WRITE) ? 'W' : 'R', expected[index].devAddr,
+                   expected[index].reg, expected[index].value);
+            s_failures++;
+        }
+    }
+}
+
+/* A run with a full write folds into one write, a run of modifies into one read and one write. */
+static void TEST_ScriptFold(void)
+{
+    static const phy_dp83825_script_t written[] = {
+        PHY_DP83825_SCRIPT_WRITE(TEST_REG, 0x1234U),
+        PHY_DP83825_SCRIPT_MODIFY(TEST_REG, 0x00F0U, 0x0050U),
+        PHY_DP83825_SCRIPT_SET(TEST_REG, 0x8000U),
+    };
+    static const test_frame_t writtenFrames[] = {{TEST_WRITE, 0U, TEST_REG, 0x9254U}};
+    static const phy_dp83825_script_t modified[] = {
+        PHY_DP83825_SCRIPT_MODIFY(TEST_REG, 0x000FU, 0x0003U),
+        PHY_DP83825_SCRIPT_CLEAR(TEST_REG, 0x0F00U),
+    };
+    static const test_frame_t modifiedFrames[] = {{TEST_READ, 0U, TEST_REG, 0xAA00U},
+                                                  {TEST_WRITE, 0U, TEST_REG, 0xA003U}};
+
+    TEST_Run(written, 3U, 0x0000U, kStatus_Success, writtenFrames, 1U);
+    TEST_Run(modified, 2U, 0xAA00U, kStatus_Success, modifiedFrames, 2U);
+}
+
+/* A modify that changes nothing is only read, a write is issued even then. */
+static void TEST_ScriptUnchanged(void)
+{
+    static const phy_dp83825_script_t modify[] = {
+        PHY_DP83825_SCRIPT_MODIFY(TEST_REG, 0x000FU, 0x0003U),
+    };
+    static const test_frame_t modifyFrames[] = {{TEST_READ, 0U, TEST_REG, 0xA003U}};
+    static const phy_dp83825_script_t write[] = {
+        PHY_DP83825_SCRIPT_WRITE(TEST_REG, 0xA003U),
+    };
+    static const test_frame_t writeFrames[] = {{TEST_WRITE, 0U, TEST_REG, 0xA003U}};
+
+    TEST_Run(modify, 1U, 0xA003U, kStatus_Success, modifyFrames, 1U);
+    TEST_Run(write, 1U, 0xA003U, kStatus_Success, writeFrames, 1U);
+}
+
+/* A wait polls every PHY_SCRIPT_POLL_US until its timeout and stops the script there. */
+static void TEST_ScriptWait(void)
+{
+    static const phy_dp83825_script_t met[] = {
+        PHY_DP83825_SCRIPT_WAIT(TEST_REG, 0x0003U, 0x0003U, 1U),
+    };
+    static const test_frame_t metFrames[] = {{TEST_READ, 0U, TEST_REG, 0xA003U}};
+    static const phy_dp83825_script_t timeout[] = {
+        PHY_DP83825_SCRIPT_WAIT(TEST_REG, 0x0001U, 0x0000U, 1U),
+        PHY_DP83825_SCRIPT_WRITE(TEST_REG, 0x0000U),
+    };
+    test_frame_t timeoutFrames[11];
+    uint32_t startUs;
+    uint32_t index;
+
+    for (index = 0U; index < 11U; index++)
+    {
+        timeoutFrames[index].op      = TEST_READ;
+        timeoutFrames[index].devAddr = 0U;
+        timeoutFrames[index].reg     = TEST_REG;
+        timeoutFrames[index].value   = 0xA003U;
+    }
+
+    TEST_Run(met, 1U, 0xA003U, kStatus_Success, metFrames, 1U);
+
+    /* 1 ms is 10 polls after the first read, the write after the wait is never issued. */
+    startUs = PHY_DP83825_SimTimeUs();
+    TEST_Run(timeout, 2U, 0xA003U, kStatus_Timeout, timeoutFrames, 11U);
+    CHECK((PHY_DP83825_SimTimeUs() - startUs) >= 1000U);
+    CHECK(s_phy.regs[TEST_REG] == 0xA003U);
+}
+
+/* A PHY ID condition skips its count of entries when the ID does not match, they never fold across it. */
+static void TEST_ScriptIfPhyId(void)
+{
+    static const phy_dp83825_script_t other[] = {
+        PHY_DP83825_SCRIPT_IF_PHYID(0xFFF0U, (uint16_t)DP83825S_PHY_ID & 0xFFF0U, 2U),
+        PHY_DP83825_SCRIPT_WRITE(TEST_REG, 0x0001U),
+        PHY_DP83825_SCRIPT_SET(TEST_REG, 0x0002U),
+        PHY_DP83825_SCRIPT_SET(TEST_REG, 0x0004U),
+    };
+    static const test_frame_t otherFrames[] = {{TEST_READ, 0U, TEST_REG, 0x0000U},
+                                               {TEST_WRITE, 0U, TEST_REG, 0x0004U}};
+    static const phy_dp83825_script_t same[] = {
+        PHY_DP83825_SCRIPT_IF_PHYID(0xFFF0U, (uint16_t)DP83825I_PHY_ID & 0xFFF0U, 2U),
+        PHY_DP83825_SCRIPT_WRITE(TEST_REG, 0x0001U),
+        PHY_DP83825_SCRIPT_SET(TEST_REG, 0x0002U),
+        PHY_DP83825_SCRIPT_SET(TEST_REG, 0x0004U),
+    };
+    static const test_frame_t sameFrames[] = {{TEST_WRITE, 0U, TEST_REG, 0x0007U}};
+
+    TEST_Run(other, 4U, 0x0000U, kStatus_Success, otherFrames, 2U);
+    TEST_Run(same, 4U, 0x0000U, kStatus_Success, sameFrames, 1U);
+}
+
+/* The same register number in the vendor MMD is another register, the runs split at each change. */
+static void TEST_ScriptExt(void)
+{
+    static const phy_dp83825_script_t script[] = {
+        PHY_DP83825_SCRIPT_WRITE(TEST_REG, 0x1111U),
+        PHY_DP83825_SCRIPT_EXT_WRITE(TEST_REG, 0x2222U),
+        PHY_DP83825_SCRIPT_EXT_SET(TEST_REG, 0x0100U),
+        PHY_DP83825_SCRIPT_SET(TEST_REG, 0x0008U),
+    };
+    static const test_frame_t frames[] = {{TEST_WRITE, 0U, TEST_REG, 0x1111U},
+                                          {TEST_WRITE, DP83822_DEVADDR, TEST_REG, 0x2322U},
+                                          {TEST_READ, 0U, TEST_REG, 0x1111U},
+                                          {TEST_WRITE, 0U, TEST_REG, 0x1119U}};
+
+    TEST_Run(script, 4U, 0x0000U, kStatus_Success, frames, 4U);
+    CHECK(s_phy.regs[TEST_REG] == 0x1119U);
+    CHECK(s_phy.ext[TEST_REG] == 0x2322U);
+}
+
+int main(void)
+{
+    TEST_Init();
+    TEST_ScriptFold();
+    TEST_ScriptUnchanged();
+    TEST_ScriptWait();
+    TEST_ScriptIfPhyId();
+    TEST_ScriptExt();
+
+    printf("phydp83825_script_test: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,496 @@
+/*
+ * phydp83825_sim.c
+ *
+ *  Register model of the DP83822/DP83825/DP83826 PHYs for the host tests.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* REGCR functions, ADDAR holds the address or the data depending on the function. */
+#define PHY_SIM_REGCR_FUNC_SHIFT   (14U)
+#define PHY_SIM_REGCR_FUNC_ADDRESS (0U)
+#define PHY_SIM_REGCR_FUNC_DATA    (1U)
+#define PHY_SIM_REGCR_FUNC_INC_RW  (2U)
+#define PHY_SIM_REGCR_FUNC_INC_W   (3U)
+
+/* BMSR link status and auto-negotiation complete, the link bit latches low. */
+#define PHY_SIM_BMSR_LINK       BIT(2)
+#define PHY_SIM_BMSR_AN_DONE    BIT(5)
+#define PHY_SIM_BMCR_LOOPBACK   BIT(14)
+#define PHY_SIM_BMCR_SPEED100   BIT(13)
+#define PHY_SIM_BMCR_RESET      BIT(15)
+#define PHY_SIM_BMCR_RESTART_AN BIT(9)
+
+/* Interrupt status bits sit 8 bits above their enables. */
+#define PHY_SIM_MISR_STATUS(enable) ((uint16_t)((enable) << 8U))
+
+#define PHY_SIM_BISCR_READ_ONLY \
+    (DP83822_BISCR_PKT_GEN_BUSY | DP83822_BISCR_PRBS_LOCK | DP83822_BISCR_PRBS_SYNC_LOSS)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*! @brief Bus of the context free resource functions. */
+static phy_dp83825_sim_bus_t *s_simBus;
+
+/*! @brief Simulated time. */
+static uint32_t s_simTimeUs;
+
+static bool s_simRealTime;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+uint32_t PHY_DP83825_SimTimeUs(void)
+{
+    struct timespec now;
+
+    if (!s_simRealTime)
+    {
+        return s_simTimeUs;
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000U) + ((uint64_t)now.tv_nsec / 1000U));
+}
+
+void PHY_DP83825_SimDelayUs(uint32_t delayUs)
+{
+    struct timespec delay;
+
+    if (!s_simRealTime)
+    {
+        s_simTimeUs += delayUs;
+        return;
+    }
+    delay.tv_sec  = (time_t)(delayUs / 1000000U);
+    delay.tv_nsec = (long)(delayUs % 1000000U) * 1000L;
+    (void)nanosleep(&delay, NULL);
+}
+
+void SDK_DelayAtLeastUs(uint32_t delayTime_us, uint32_t coreClock_Hz)
+{
+    (void)coreClock_Hz;
+    PHY_DP83825_SimDelayUs(delayTime_us);
+}
+
+void PHY_DP83825_SimSetRealTime(bool realTime)
+{
+    s_simRealTime = realTime;
+}
+
+static void PHY_DP83825_SimUpdateInt(phy_dp83825_sim_phy_t *phy)
+{
+    uint16_t misr1 = phy->regs[MII_DP83822_MISR1];
+    uint16_t misr2 = phy->regs[MII_DP83822_MISR2];
+    bool enabled   = (phy->regs[MII_DP83822_PHYSCR] & (DP83822_PHYSCR_INT_OE | DP83822_PHYSCR_INTEN)) ==
+                   (DP83822_PHYSCR_INT_OE | DP83822_PHYSCR_INTEN);
+    bool asserted = enabled && ((((misr1 >> 8U) & misr1 & 0xFFU) != 0U) || (((misr2 >> 8U) & misr2 & 0xFFU) != 0U));
+
+    if (asserted && !phy->intAsserted && (phy->irq != NULL))
+    {
+        phy->intAsserted = asserted;
+        phy->irq(phy->irqContext);
+        return;
+    }
+    phy->intAsserted = asserted;
+}
+
+/* Advances the PRBS checker to now, counting the injected errors. */
+static void PHY_DP83825_SimBistUpdate(phy_dp83825_sim_phy_t *phy)
+{
+    uint32_t now = PHY_DP83825_SimTimeUs();
+    uint64_t bits;
+
+    if ((phy->regs[MII_DP83822_BISCR] & DP83822_BISCR_PKT_GEN_EN) != 0U)
+    {
+        bits = (uint64_t)(now - phy->bistUpdateUs) *
+               (((phy->regs[PHY_BASICCONTROL_REG] & PHY_SIM_BMCR_SPEED100) != 0U) ? 100U : 10U);
+        phy->bistErrorAcc += bits * phy->bistErrorsPerGbit;
+        phy->bistCount += (uint32_t)(phy->bistErrorAcc / 1000000000U);
+        phy->bistErrorAcc %= 1000000000U;
+        if ((phy->regs[MII_DP83822_BISCR] & DP83822_BISCR_ERR_CNT_MODE) != 0U)
+        {
+            phy->bistCount &= 0xFFU;
+        }
+        else if (phy->bistCount > 0xFFU)
+        {
+            phy->bistCount = 0xFFU;
+        }
+    }
+    phy->bistUpdateUs = now;
+}
+
+void PHY_DP83825_SimReset(phy_dp83825_sim_phy_t *phy)
+{
+    bool linkUp = phy->linkUp;
+
+    (void)memset(phy->regs, 0, sizeof(phy->regs));
+    (void)memset(phy->ext, 0, sizeof(phy->ext));
+    (void)memset(phy->pcs, 0, sizeof(phy->pcs));
+    (void)memset(phy->an, 0, sizeof(phy->an));
+    phy->regs[PHY_BASICCONTROL_REG]      = 0x3100U;
+    phy->regs[PHY_BASICSTATUS_REG]       = 0x7849U;
+    phy->regs[PHY_ID1_REG]               = (uint16_t)(phy->phyId >> 16U);
+    phy->regs[PHY_ID2_REG]               = (uint16_t)phy->phyId;
+    phy->regs[PHY_AUTONEG_ADVERTISE_REG] = 0x01E1U;
+    phy->regs[MII_DP83822_RCSR]          = 0x0061U;
+    phy->regs[MII_DP83822_PHYCR]         = DP83822_MDIX_AUTO_EN;
+    phy->ext[MII_DP83822_SOR1]           = phy->sor1;
+    phy->addar                           = 0U;
+    phy->linkUp                          = false;
+    phy->intAsserted                     = false;
+    phy->idLost                          = false;
+    phy->bistErrorAcc                    = 0U;
+    phy->bistCount                       = 0U;
+    phy->resets++;
+    if (linkUp)
+    {
+        PHY_DP83825_SimSetLink(phy, true, phy->linkSpeed, phy->linkDuplex);
+    }
+}
+
+void PHY_DP83825_SimSetLink(phy_dp83825_sim_phy_t *phy, bool up, phy_speed_t speed, phy_duplex_t duplex)
+{
+    bool changed = (phy->linkUp != up);
+    uint16_t ability;
+
+    phy->linkUp     = up;
+    phy->linkSpeed  = speed;
+    phy->linkDuplex = duplex;
+    if (up)
+    {
+        ability = (speed == kPHY_Speed100M) ? ((duplex == kPHY_FullDuplex) ? 0x0100U : 0x0080U) :
+                                              ((duplex == kPHY_FullDuplex) ? 0x0040U : 0x0020U);
+        phy->regs[PHY_BASICSTATUS_REG] |= PHY_SIM_BMSR_LINK | PHY_SIM_BMSR_AN_DONE;
+        phy->regs[MII_DP83822_PHYSTS] = DP83822_PHYSTS_LINK | DP83822_PHYSTS_SIGNAL_DETECT |
+                                        ((speed == kPHY_Speed10M) ? DP83822_PHYSTS_10 : 0U) |
+                                        ((duplex == kPHY_FullDuplex) ? DP83822_PHYSTS_DUPLEX : 0U);
+        phy->regs[PHY_AUTONEG_LINKPARTNER_REG] = (uint16_t)(0x4001U | DP83822_AN_PAUSE | ability);
+        phy->regs[PHY_AUTONEG_EXPANSION_REG] |= DP83822_ANER_LP_AN_ABLE;
+        phy->regs[MII_DP83822_MISR1] |= PHY_SIM_MISR_STATUS(DP83822_ANEG_COMPLETE_INT_EN) |
+                                        PHY_SIM_MISR_STATUS(DP83822_SPEED_CHANGED_INT_EN) |
+                                        PHY_SIM_MISR_STATUS(DP83822_DUP_MODE_CHANGE_INT_EN);
+    }
+    else
+    {
+        /* The link bit latches low until read. */
+        phy->regs[PHY_BASICSTATUS_REG] &= (uint16_t)~(PHY_SIM_BMSR_LINK | PHY_SIM_BMSR_AN_DONE);
+        phy->regs[MII_DP83822_PHYSTS]                  = 0U;
+        phy->regs[PHY_AUTONEG_LINKPARTNER_REG] = 0U;
+    }
+    if (changed)
+    {
+        phy->regs[MII_DP83822_MISR1] |= PHY_SIM_MISR_STATUS(DP83822_LINK_STAT_INT_EN);
+    }
+    PHY_DP83825_SimUpdateInt(phy);
+}
+
+static uint16_t *PHY_DP83825_SimExtReg(phy_dp83825_sim_phy_t *phy, uint8_t devAddr, uint16_t regAddr)
+{
+    if ((devAddr == DP83822_DEVADDR) && (regAddr < PHY_DP83825_SIM_EXT_SIZE))
+    {
+        return &phy->ext[regAddr];
+    }
+    if ((devAddr == DP83822_MMD_PCS) && (regAddr < PHY_DP83825_SIM_MMD_SIZE))
+    {
+        return &phy->pcs[regAddr];
+    }
+    if ((devAddr == DP83822_MMD_AN) && (regAddr < PHY_DP83825_SIM_MMD_SIZE))
+    {
+        return &phy->an[regAddr];
+    }
+    return NULL;
+}
+
+static uint16_t PHY_DP83825_SimRead22(phy_dp83825_sim_phy_t *phy, uint8_t regAddr)
+{
+    uint16_t regcr = phy->regs[MII_DP83822_REGCR];
+    uint16_t func  = (uint16_t)(regcr >> PHY_SIM_REGCR_FUNC_SHIFT);
+    uint16_t value = phy->regs[regAddr & 0x1FU];
+    uint16_t *reg;
+
+    switch (regAddr)
+    {
+        case MII_DP83822_ADDAR:
+            if (func == PHY_SIM_REGCR_FUNC_ADDRESS)
+            {
+                return phy->addar;
+            }
+            reg   = PHY_DP83825_SimExtReg(phy, (uint8_t)(regcr & DP83822_REGCR_DEVAD_MASK), phy->addar);
+            value = (reg != NULL) ? *reg : 0U;
+            if (func == PHY_SIM_REGCR_FUNC_INC_RW)
+            {
+                phy->addar++;
+            }
+            return value;
+        case PHY_ID1_REG:
+        case PHY_ID2_REG:
+            return phy->idLost ? 0xFFFFU : value;
+        case PHY_BASICSTATUS_REG:
+            if (phy->linkUp)
+            {
+                phy->regs[regAddr] |= PHY_SIM_BMSR_LINK;
+            }
+            return value;
+        case MII_DP83822_MISR1:
+        case MII_DP83822_MISR2:
+            phy->regs[regAddr] &= 0x00FFU;
+            PHY_DP83825_SimUpdateInt(phy);
+            return value;
+        case MII_DP83822_BISCR:
+            PHY_DP83825_SimBistUpdate(phy);
+            value &= (uint16_t)~PHY_SIM_BISCR_READ_ONLY;
+            if ((value & DP83822_BISCR_PKT_GEN_EN) != 0U)
+            {
+                value |= DP83822_BISCR_PKT_GEN_BUSY;
+                /* The checker locks when the packets come back, through a loopback or the line. */
+                if (((value & DP83822_BISCR_LOOPBACKMODE_MASK) != 0U) ||
+                    ((phy->regs[PHY_BASICCONTROL_REG] & PHY_SIM_BMCR_LOOPBACK) != 0U) || phy->linkUp)
+                {
+                    value |= DP83822_BISCR_PRBS_LOCK;
+                }
+            }
+            return value;
+        case MII_DP83822_BICSR1:
+            PHY_DP83825_SimBistUpdate(phy);
+            value          = (uint16_t)((value & 0x00FFU) | FIELD_PREP(DP83822_BICSR1_ERR_COUNT_MASK, phy->bistCount));
+            phy->bistCount = 0U;
+            return value;
+        default:
+            return value;
+    }
+}
+
+static void PHY_DP83825_SimWrite22(phy_dp83825_sim_phy_t *phy, uint8_t regAddr, uint16_t data)
+{
+    uint16_t regcr = phy->regs[MII_DP83822_REGCR];
+    uint16_t func  = (uint16_t)(regcr >> PHY_SIM_REGCR_FUNC_SHIFT);
+    uint16_t *reg;
+
+    switch (regAddr)
+    {
+        case PHY_BASICCONTROL_REG:
+            if ((data & PHY_SIM_BMCR_RESET) != 0U)
+            {
+                PHY_DP83825_SimReset(phy);
+                return;
+            }
+            phy->regs[regAddr] = data & (uint16_t)~PHY_SIM_BMCR_RESTART_AN;
+            return;
+        case PHY_BASICSTATUS_REG:
+        case PHY_ID1_REG:
+        case PHY_ID2_REG:
+        case MII_DP83822_PHYSTS:
+            return;
+        case MII_DP83822_ADDAR:
+            if (func == PHY_SIM_REGCR_FUNC_ADDRESS)
+            {
+                phy->addar = data;
+                return;
+            }
+            reg = PHY_DP83825_SimExtReg(phy, (uint8_t)(regcr & DP83822_REGCR_DEVAD_MASK), phy->addar);
+            if (reg != NULL)
+            {
+                *reg = data;
+            }
+            if (func != PHY_SIM_REGCR_FUNC_DATA)
+            {
+                phy->addar++;
+            }
+            return;
+        case MII_DP83822_MISR1:
+        case MII_DP83822_MISR2:
+            phy->regs[regAddr] = (uint16_t)((phy->regs[regAddr] & 0xFF00U) | (data & 0x00FFU));
+            PHY_DP83825_SimUpdateInt(phy);
+            return;
+        case MII_DP83822_PHYSCR:
+            phy->regs[regAddr] = data;
+            PHY_DP83825_SimUpdateInt(phy);
+            return;
+        case MII_DP83822_BISCR:
+            if (((data & DP83822_BISCR_PKT_GEN_EN) != 0U) &&
+                ((phy->regs[regAddr] & DP83822_BISCR_PKT_GEN_EN) == 0U))
+            {
+                phy->bistUpdateUs = PHY_DP83825_SimTimeUs();
+                phy->bistErrorAcc = 0U;
+                phy->bistCount    = 0U;
+            }
+            phy->regs[regAddr] = data & (uint16_t)~PHY_SIM_BISCR_READ_ONLY;
+            return;
+        case MII_DP83822_RESET_CTRL:
+            /* The hardware reset reloads the defaults, the software reset keeps the registers. */
+            if ((data & DP83822_HW_RESET) != 0U)
+            {
+                PHY_DP83825_SimReset(phy);
+            }
+            return;
+        default:
+            phy->regs[regAddr & 0x1FU] = data;
+            return;
+    }
+}
+
+/* Takes the time of one frame, returns kStatus_Timeout for an injected failure. */
+static status_t PHY_DP83825_SimFrame(phy_dp83825_sim_bus_t *bus)
+{
+    bus->frames++;
+    PHY_DP83825_SimDelayUs(bus->frameUs);
+    if (bus->slowFrames != 0U)
+    {
+        bus->slowFrames--;
+        PHY_DP83825_SimDelayUs(bus->slowUs);
+    }
+    if (bus->failAfter != 0U)
+    {
+        bus->failAfter--;
+        return kStatus_Success;
+    }
+    if (bus->failFrames != 0U)
+    {
+        bus->failFrames--;
+        return kStatus_Timeout;
+    }
+    return kStatus_Success;
+}
+
+static status_t PHY_DP83825_SimBusWrite(void *context, uint8_t phyAddr, uint8_t regAddr, uint16_t data)
+{
+    phy_dp83825_sim_bus_t *bus = (phy_dp83825_sim_bus_t *)context;
+    status_t result            = PHY_DP83825_SimFrame(bus);
+
+    if ((result == kStatus_Success) && (bus->phys[phyAddr & 0x1FU] != NULL))
+    {
+        PHY_DP83825_SimWrite22(bus->phys[phyAddr & 0x1FU], regAddr, data);
+    }
+    return result;
+}
+
+static status_t PHY_DP83825_SimBusRead(void *context, uint8_t phyAddr, uint8_t regAddr, uint16_t *pData)
+{
+    phy_dp83825_sim_bus_t *bus = (phy_dp83825_sim_bus_t *)context;
+    status_t result            = PHY_DP83825_SimFrame(bus);
+
+    if (result == kStatus_Success)
+    {
+        /* Nobody drives MDIO for an empty address, the pull-up reads all ones. */
+        *pData = (bus->phys[phyAddr & 0x1FU] != NULL) ? PHY_DP83825_SimRead22(bus->phys[phyAddr & 0x1FU], regAddr) :
+                                                         0xFFFFU;
+        if (bus->stuckHighFrames != 0U)
+        {
+            bus->stuckHighFrames--;
+            *pData = 0xFFFFU;
+        }
+    }
+    return result;
+}
+
+/* Extended accesses take the four clause 22 frames of the SDK MDIO layer. */
+static status_t PHY_DP83825_SimBusWriteExt(
+    void *context, uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data)
+{
+    status_t result = PHY_DP83825_SimBusWrite(context, phyAddr, MII_DP83822_REGCR, devAddr);
+
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_SimBusWrite(context, phyAddr, MII_DP83822_ADDAR, regAddr);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_SimBusWrite(context, phyAddr, MII_DP83822_REGCR,
+                                         (uint16_t)((PHY_SIM_REGCR_FUNC_DATA << PHY_SIM_REGCR_FUNC_SHIFT) | devAddr));
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_SimBusWrite(context, phyAddr, MII_DP83822_ADDAR, data);
+    }
+    return result;
+}
+
+static status_t PHY_DP83825_SimBusReadExt(
+    void *context, uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData)
+{
+    status_t result = PHY_DP83825_SimBusWrite(context, phyAddr, MII_DP83822_REGCR, devAddr);
+
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_SimBusWrite(context, phyAddr, MII_DP83822_ADDAR, regAddr);
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_SimBusWrite(context, phyAddr, MII_DP83822_REGCR,
+                                         (uint16_t)((PHY_SIM_REGCR_FUNC_DATA << PHY_SIM_REGCR_FUNC_SHIFT) | devAddr));
+    }
+    if (result == kStatus_Success)
+    {
+        result = PHY_DP83825_SimBusRead(context, phyAddr, MII_DP83822_ADDAR, pData);
+    }
+    return result;
+}
+
+static status_t PHY_DP83825_SimWrite(uint8_t phyAddr, uint8_t regAddr, uint16_t data)
+{
+    return PHY_DP83825_SimBusWrite(s_simBus, phyAddr, regAddr, data);
+}
+
+static status_t PHY_DP83825_SimRead(uint8_t phyAddr, uint8_t regAddr, uint16_t *pData)
+{
+    return PHY_DP83825_SimBusRead(s_simBus, phyAddr, regAddr, pData);
+}
+
+static status_t PHY_DP83825_SimWriteExt(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t data)
+{
+    return PHY_DP83825_SimBusWriteExt(s_simBus, phyAddr, devAddr, regAddr, data);
+}
+
+static status_t PHY_DP83825_SimReadExt(uint8_t phyAddr, uint8_t devAddr, uint16_t regAddr, uint16_t *pData)
+{
+    return PHY_DP83825_SimBusReadExt(s_simBus, phyAddr, devAddr, regAddr, pData);
+}
+
+void PHY_DP83825_SimBusInit(phy_dp83825_sim_bus_t *bus, uint32_t frameUs)
+{
+    (void)memset(bus, 0, sizeof(*bus));
+    bus->frameUs = frameUs;
+}
+
+void PHY_DP83825_SimAttach(phy_dp83825_sim_bus_t *bus, uint8_t phyAddr, phy_dp83825_sim_phy_t *phy, uint32_t phyId)
+{
+    (void)memset(phy, 0, sizeof(*phy));
+    phy->phyId = phyId;
+    PHY_DP83825_SimReset(phy);
+    phy->resets              = 0U;
+    bus->phys[phyAddr & 0x1FU] = phy;
+}
+
+void PHY_DP83825_SimResource(phy_dp83825_resource_t *resource, phy_dp83825_sim_bus_t *bus)
+{
+    s_simBus            = bus;
+    resource->write     = PHY_DP83825_SimWrite;
+    resource->read      = PHY_DP83825_SimRead;
+    resource->writeExt  = PHY_DP83825_SimWriteExt;
+    resource->readExt   = PHY_DP83825_SimReadExt;
+    resource->getTimeUs = PHY_DP83825_SimTimeUs;
+    resource->delayUs   = PHY_DP83825_SimDelayUs;
+}
+
+void PHY_DP83825_SimBusBind(phy_dp83825_bus_t *bus, phy_dp83825_sim_bus_t *sim, uint8_t busId)
+{
+    (void)memset(bus, 0, sizeof(*bus));
+    bus->write    = PHY_DP83825_SimBusWrite;
+    bus->read     = PHY_DP83825_SimBusRead;
+    bus->writeExt = PHY_DP83825_SimBusWriteExt;
+    bus->readExt  = PHY_DP83825_SimBusReadExt;
+    bus->context  = sim;
+    bus->busId    = busId;
+}
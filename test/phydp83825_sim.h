@@ -0,0 +1,151 @@
+/*
+ * phydp83825_sim.h
+ *
+ *  Register model of the DP83822/DP83825/DP83826 PHYs for the host tests.
+ *
+ *  Models what the driver relies on: the basic and extended register maps with their reset values,
+ *  REGCR/ADDAR extended access with post increment, BMCR and RESET_CTRL resets, the latched link
+ *  status, clear on read interrupt status with the INT pin, and the BIST packet generator with its
+ *  PRBS error counter. Registers without a model keep what was written.
+ *
+ *  Time is simulated: every MDIO frame and every delay advances the clock, so the tests run in
+ *  microseconds and give the same results on every host. In real time mode frames take wall clock
+ *  time instead, for tests measuring concurrency.
+ */
+
+#ifndef _PHYDP83825_SIM_H_
+#define _PHYDP83825_SIM_H_
+
+#include "fsl_phydp83825.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Registers modelled per MMD. */
+#define PHY_DP83825_SIM_EXT_SIZE (0x500U)
+#define PHY_DP83825_SIM_MMD_SIZE (0x40U)
+
+/*! @brief Modelled PHY. */
+typedef struct _phy_dp83825_sim_phy
+{
+    uint32_t phyId;                          /*!< PHY ID, set before the first reset. */
+    uint16_t sor1;                           /*!< Strap values, read back in SOR1 after each reset. */
+    uint16_t regs[32];                       /*!< Basic registers. */
+    uint16_t ext[PHY_DP83825_SIM_EXT_SIZE];  /*!< Vendor MMD 0x1F. */
+    uint16_t pcs[PHY_DP83825_SIM_MMD_SIZE];  /*!< PCS MMD 3. */
+    uint16_t an[PHY_DP83825_SIM_MMD_SIZE];   /*!< Auto-negotiation MMD 7. */
+    uint16_t addar;                          /*!< Extended address selected through ADDAR. */
+    bool linkUp;                             /*!< Link state of the line, kept across resets. */
+    phy_speed_t linkSpeed;                   /*!< Speed of the line. */
+    phy_duplex_t linkDuplex;                 /*!< Duplex of the line. */
+    bool idLost;                             /*!< PHYIDR1/2 read 0xFFFF until a hardware reset. */
+    bool intAsserted;                        /*!< INT pin level, active. */
+    void (*irq)(void *context);              /*!< Called on each INT assertion, models an edge interrupt. */
+    void *irqContext;                        /*!< Passed to irq. */
+    uint32_t bistErrorsPerGbit;              /*!< PRBS bit errors injected per 10^9 bits. */
+    uint64_t bistErrorAcc;                   /*!< Error fraction carried to the next update. */
+    uint32_t bistUpdateUs;                   /*!< Time of the last BIST update. */
+    uint32_t bistCount;                      /*!< PRBS error counter. */
+    uint32_t resets;                         /*!< Resets seen. */
+} phy_dp83825_sim_phy_t;
+
+/*! @brief Modelled MDIO bus. */
+typedef struct _phy_dp83825_sim_bus
+{
+    phy_dp83825_sim_phy_t *phys[32]; /*!< PHYs on the bus, by address. */
+    uint32_t frameUs;                /*!< Duration of one MDIO frame. */
+    uint32_t frames;                 /*!< MDIO frames issued. */
+    uint32_t failFrames;             /*!< The next frames fail with kStatus_Timeout. */
+    uint32_t failAfter;              /*!< Frames left until failFrames applies, 0 for right away. */
+    uint32_t slowFrames;             /*!< The next frames take slowUs longer and still succeed. */
+    uint32_t slowUs;                 /*!< Extra duration of a slow frame. */
+    uint32_t stuckHighFrames;        /*!< The next reads answer 0xFFFF, MDIO stuck high. */
+} phy_dp83825_sim_bus_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes a bus without PHYs.
+ *
+ * @param bus      The bus.
+ * @param frameUs  Duration of one MDIO frame, 25 us for a 2.5 MHz MDC.
+ */
+void PHY_DP83825_SimBusInit(phy_dp83825_sim_bus_t *bus, uint32_t frameUs);
+
+/*!
+ * @brief Puts a PHY on a bus and resets it.
+ *
+ * @param bus      The bus.
+ * @param phyAddr  PHY address.
+ * @param phy      The PHY, must stay valid while attached.
+ * @param phyId    PHY ID, e.g. DP83825I_PHY_ID.
+ */
+void PHY_DP83825_SimAttach(phy_dp83825_sim_bus_t *bus, uint8_t phyAddr, phy_dp83825_sim_phy_t *phy, uint32_t phyId);
+
+/*!
+ * @brief Resets a PHY to its register defaults, as a power cycle does.
+ *
+ * The line stays as it is, a link up comes back right away.
+ *
+ * @param phy  The PHY.
+ */
+void PHY_DP83825_SimReset(phy_dp83825_sim_phy_t *phy);
+
+/*!
+ * @brief Changes the link, with the status and interrupt updates of the PHY.
+ *
+ * The link partner is modelled as auto-negotiation capable, advertising the given mode.
+ *
+ * @param phy     The PHY.
+ * @param up      Link state.
+ * @param speed   Link speed.
+ * @param duplex  Link duplex.
+ */
+void PHY_DP83825_SimSetLink(phy_dp83825_sim_phy_t *phy, bool up, phy_speed_t speed, phy_duplex_t duplex);
+
+/*!
+ * @brief Sets up the resource functions of the single bus interface on a bus.
+ *
+ * The resource functions have no context, the bus is the one of the last call.
+ *
+ * @param resource  The resource, the MDIO functions and the time source are filled in.
+ * @param bus       The bus.
+ */
+void PHY_DP83825_SimResource(phy_dp83825_resource_t *resource, phy_dp83825_sim_bus_t *bus);
+
+/*!
+ * @brief Sets up a driver bus, see phy_dp83825_bus_t.
+ *
+ * @param bus    The driver bus, without lock.
+ * @param sim    The modelled bus, the context of the bus functions.
+ * @param busId  Bus number.
+ */
+void PHY_DP83825_SimBusBind(phy_dp83825_bus_t *bus, phy_dp83825_sim_bus_t *sim, uint8_t busId);
+
+/*!
+ * @brief Switches between simulated and wall clock time.
+ *
+ * In real time mode frames sleep for their duration, and buses can run in parallel threads.
+ *
+ * @param realTime  Use wall clock time.
+ */
+void PHY_DP83825_SimSetRealTime(bool realTime);
+
+/*! @brief Current time in microseconds, the time source of the resource. */
+uint32_t PHY_DP83825_SimTimeUs(void);
+
+/*! @brief Waits, the delay function of the resource. */
+void PHY_DP83825_SimDelayUs(uint32_t delayUs);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* _PHYDP83825_SIM_H_ */
@@ -0,0 +1,145 @@
+/*
+ * phydp83825_watchdog_test.c
+ *
+ *  Hang detection and recovery of the DP83825 PHY driver against the PHY model, with three
+ *  injected faults: a PHY answering its ID with all ones, auto-negotiation stuck with a signal on
+ *  the line, and RCSR lost behind the driver's back. Checks the hang reported, the soft reset
+ *  escalating to a hard reset only when needed, and the configuration restored.
+ */
+
+#include <stdio.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PHY_TEST_ADDR (1U)
+#define TEST_POLLS    (20U)
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static phy_dp83825_sim_bus_t s_bus;
+static phy_dp83825_sim_phy_t s_phy;
+static phy_dp83825_resource_t s_resource;
+static phy_handle_t s_handle;
+static uint32_t s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_Init(void)
+{
+    phy_dp83825_watchdog_config_t watchdog = {0};
+    phy_config_t config                    = {0};
+
+    PHY_DP83825_SimBusInit(&s_bus, 25U);
+    PHY_DP83825_SimAttach(&s_bus, PHY_TEST_ADDR, &s_phy, DP83825I_PHY_ID);
+    (void)memset(&s_resource, 0, sizeof(s_resource));
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+    config.phyAddr  = PHY_TEST_ADDR;
+    config.resource = &s_resource;
+    config.ops      = &phydp83825_ops;
+    config.autoNeg  = true;
+    CHECK(PHY_Init(&s_handle, &config) == kStatus_Success);
+
+    watchdog.busErrorLimit  = 3U;
+    watchdog.autoNegLimit   = 5U;
+    watchdog.verifyInterval = 4U;
+    PHY_DP83825_SetWatchdogConfig(&s_handle, &watchdog);
+}
+
+/* Polls the link until the watchdog reports a hang, returns it. */
+static phy_dp83825_hang_t TEST_PollHang(void)
+{
+    phy_dp83825_hang_t hang = kPHY_DP83825_HangNone;
+    uint32_t poll;
+    bool up;
+
+    for (poll = 0U; (poll < TEST_POLLS) && (hang == kPHY_DP83825_HangNone); poll++)
+    {
+        (void)PHY_GetLinkStatus(&s_handle, &up);
+        PHY_DP83825_GetHangStatus(&s_handle, &hang, NULL);
+    }
+    return hang;
+}
+
+/* Recovers the PHY, checks the resets it took and that the hang is cleared. */
+static void TEST_Recover(phy_dp83825_hang_t expected, uint32_t softResets, uint32_t hardResets)
+{
+    phy_dp83825_recovery_stats_t stats;
+    phy_dp83825_hang_t hang;
+
+    CHECK(TEST_PollHang() == expected);
+    CHECK(PHY_DP83825_Recover(&s_handle) == kStatus_Success);
+    PHY_DP83825_GetHangStatus(&s_handle, &hang, &stats);
+    CHECK(hang == kPHY_DP83825_HangNone);
+    CHECK(stats.lastHang == expected);
+    CHECK(stats.hangs == 1U);
+    CHECK(stats.softResets == softResets);
+    CHECK(stats.hardResets == hardResets);
+    CHECK(stats.failedRecoveries == 0U);
+    CHECK(stats.lastRecoveryUs != 0U);
+    CHECK(stats.maxRecoveryUs >= stats.lastRecoveryUs);
+    printf("hang %u: %u soft and %u hard resets, recovered in %u us\n", (uint32_t)expected, stats.softResets,
+           stats.hardResets, stats.lastRecoveryUs);
+}
+
+/* The PHY answers its ID with all ones, a soft reset does not help, the hard reset does. */
+static void TEST_HangId(void)
+{
+    TEST_Init();
+    s_phy.idLost = true;
+    TEST_Recover(kPHY_DP83825_HangBus, 1U, 1U);
+    CHECK(!s_phy.idLost);
+}
+
+/* Signal on the line, auto-negotiation never completes: a soft reset is enough. */
+static void TEST_HangAutoNeg(void)
+{
+    TEST_Init();
+    s_phy.regs[MII_DP83822_PHYSTS] |= DP83822_PHYSTS_SIGNAL_DETECT;
+    TEST_Recover(kPHY_DP83825_HangAutoNeg, 1U, 0U);
+}
+
+/* RCSR back at its reset value behind the driver's back, the recovery writes it again. */
+static void TEST_HangConfigLost(void)
+{
+    uint16_t rcsr;
+
+    TEST_Init();
+    rcsr = s_phy.regs[MII_DP83822_RCSR];
+    CHECK(rcsr != 0x0061U);
+    s_phy.regs[MII_DP83822_RCSR] = 0x0061U;
+    TEST_Recover(kPHY_DP83825_HangConfigLost, 1U, 0U);
+    CHECK(s_phy.regs[MII_DP83822_RCSR] == rcsr);
+
+    /* The elastic buffer status bits are traffic, not a lost configuration. */
+    s_phy.regs[MII_DP83822_RCSR] |= DP83822_RX_UNF_STS | DP83822_RX_OVF_STS;
+    CHECK(TEST_PollHang() == kPHY_DP83825_HangNone);
+}
+
+int main(void)
+{
+    TEST_HangId();
+    TEST_HangAutoNeg();
+    TEST_HangConfigLost();
+
+    printf("phydp83825_watchdog_test: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
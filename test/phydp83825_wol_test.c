@@ -0,0 +1,102 @@
+/*
+ * phydp83825_wol_test.c
+ *
+ *  Wake on LAN configuration of the DP83825 PHY driver against the PHY model: the magic packet
+ *  address and the configuration, with the SecureOn password only when SecureOn is asked for.
+ */
+
+#include <stdio.h>
+
+#include "phydp83825_sim.h"
+#include "fsl_phydp83825_regs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PHY_TEST_ADDR (1U)
+
+/* Written to the password registers beforehand, kept without SecureOn. */
+#define TEST_RXSOP_MARK (0xA5A5U)
+
+#define CHECK(condition)                                                     \
+    do                                                                       \
+    {                                                                        \
+        if (!(condition))                                                    \
+        {                                                                    \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static phy_dp83825_sim_bus_t s_bus;
+static phy_dp83825_sim_phy_t s_phy;
+static phy_dp83825_resource_t s_resource;
+static phy_handle_t s_handle;
+static uint32_t s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_Init(void)
+{
+    phy_config_t config = {0};
+
+    PHY_DP83825_SimBusInit(&s_bus, 25U);
+    PHY_DP83825_SimAttach(&s_bus, PHY_TEST_ADDR, &s_phy, DP83825I_PHY_ID);
+    (void)memset(&s_resource, 0, sizeof(s_resource));
+    PHY_DP83825_SimResource(&s_resource, &s_bus);
+    config.phyAddr  = PHY_TEST_ADDR;
+    config.resource = &s_resource;
+    config.ops      = &phydp83825_ops;
+    config.autoNeg  = true;
+    CHECK(PHY_Init(&s_handle, &config) == kStatus_Success);
+    s_phy.ext[MII_DP83822_RXSOP1] = TEST_RXSOP_MARK;
+    s_phy.ext[MII_DP83822_RXSOP2] = TEST_RXSOP_MARK;
+    s_phy.ext[MII_DP83822_RXSOP3] = TEST_RXSOP_MARK;
+}
+
+static void TEST_WakeOnLan(bool secureOn)
+{
+    phy_dp83825_wol_config_t config = {{0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U},
+                                       true,
+                                       secureOn,
+                                       {0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU}};
+    uint16_t wolCfg;
+
+    TEST_Init();
+    CHECK(PHY_DP83825_ConfigureWakeOnLan(&s_handle, &config) == kStatus_Success);
+    CHECK(s_phy.ext[MII_DP83822_WOL_DA1] == 0x1100U);
+    CHECK(s_phy.ext[MII_DP83822_WOL_DA2] == 0x3322U);
+    CHECK(s_phy.ext[MII_DP83822_WOL_DA3] == 0x5544U);
+
+    wolCfg = s_phy.ext[MII_DP83822_WOL_CFG];
+    CHECK((wolCfg & (DP83822_WOL_EN | DP83822_WOL_MAGIC_EN)) == (DP83822_WOL_EN | DP83822_WOL_MAGIC_EN));
+    CHECK(((wolCfg & DP83822_WOL_SECURE_ON) != 0U) == secureOn);
+    if (secureOn)
+    {
+        CHECK(s_phy.ext[MII_DP83822_RXSOP1] == 0x7766U);
+        CHECK(s_phy.ext[MII_DP83822_RXSOP2] == 0x9988U);
+        CHECK(s_phy.ext[MII_DP83822_RXSOP3] == 0xBBAAU);
+    }
+    else
+    {
+        CHECK(s_phy.ext[MII_DP83822_RXSOP1] == TEST_RXSOP_MARK);
+        CHECK(s_phy.ext[MII_DP83822_RXSOP2] == TEST_RXSOP_MARK);
+        CHECK(s_phy.ext[MII_DP83822_RXSOP3] == TEST_RXSOP_MARK);
+    }
+}
+
+int main(void)
+{
+    TEST_WakeOnLan(false);
+    TEST_WakeOnLan(true);
+
+    printf("phydp83825_wol_test: %s\n", (s_failures == 0U) ? "passed" : "FAILED");
+    return (s_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+#!/bin/sh
+#
+# run_tests.sh
+#
+#  Host tests of the DP83825 PHY driver against the PHY model in phydp83825_sim.c.
+#
+#  Usage: CC=cc CXX=c++ NM=nm run_tests.sh [driver directory]
+#
+#  Builds each test with the driver sources, C++ tests with the driver built as C, host/ holds the
+#  SDK and lwIP headers the driver needs.
+#  Runs each test and prints its result. Exits with the number of failed tests.
+
+CC=${CC:-cc}
+CXX=${CXX:-c++}
+CFLAGS=${CFLAGS:--std=gnu99 -O1 -Wall -Wextra}
+CXXFLAGS=${CXXFLAGS:--std=c++20 -O2 -Wall -Wextra}
+NM=${NM:-nm}
+SRC_DIR=${1:-$(dirname "$0")/..}
+TEST_DIR=$SRC_DIR/test
+
+WORK=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORK"' EXIT
+
+failed=0
+
+# run <name> <sources...>, builds and runs one test.
+run()
+{
+    name=$1
+    shift
+    # shellcheck disable=SC2086
+    if ! $CC $CFLAGS -I"$TEST_DIR/host" -I"$TEST_DIR" -I"$SRC_DIR" -o "$WORK/$name" "$@" \
+        "$TEST_DIR/phydp83825_sim.c" "$SRC_DIR/fsl_phydp83825.c" "$SRC_DIR/fsl_phydp83825_trace.c"; then
+        echo "$name: build failed"
+        failed=$((failed + 1))
+        return
+    fi
+    if ! "$WORK/$name"; then
+        failed=$((failed + 1))
+    fi
+}
+
+# run_cxx <name> <source>, builds and runs one C++ test, the driver sources are built as C.
+run_cxx()
+{
+    name=$1
+    objects=
+    for source in "$TEST_DIR/phydp83825_sim.c" "$SRC_DIR/fsl_phydp83825.c" "$SRC_DIR/fsl_phydp83825_trace.c"; do
+        object="$WORK/$name.$(basename "$source" .c).o"
+        # shellcheck disable=SC2086
+        if ! $CC $CFLAGS -I"$TEST_DIR/host" -I"$TEST_DIR" -I"$SRC_DIR" -c -o "$object" "$source"; then
+            echo "$name: build failed"
+            failed=$((failed + 1))
+            return
+        fi
+        objects="$objects $object"
+    done
+    # shellcheck disable=SC2086
+    if ! $CXX $CXXFLAGS -I"$TEST_DIR/host" -I"$TEST_DIR" -I"$SRC_DIR" -o "$WORK/$name" "$2" $objects; then
+        echo "$name: build failed"
+        failed=$((failed + 1))
+        return
+    fi
+    if ! "$WORK/$name"; then
+        failed=$((failed + 1))
+    fi
+}
+
+# check_regfield <source>, builds the typed field checks: the typed and the raw build at -O2 must
+# give functions of the same size, each TEST_FAIL_* must not build.
+check_regfield()
+{
+    name=$(basename "$1" .cpp)
+    errors=$failed
+    for variant in typed raw; do
+        define=
+        if [ "$variant" = typed ]; then
+            define=-DTEST_TYPED
+        fi
+        # shellcheck disable=SC2086
+        if ! $CXX $CXXFLAGS -O2 $define -I"$TEST_DIR/host" -I"$TEST_DIR" -I"$SRC_DIR" -c \
+            -o "$WORK/$name.$variant.o" "$1"; then
+            echo "$name: build failed"
+            failed=$((failed + 1))
+            return
+        fi
+        $NM -S -C "$WORK/$name.$variant.o" | awk '$3 == "T" { $1 = ""; print }' | sort >"$WORK/$name.$variant.sizes"
+    done
+    if ! cmp -s "$WORK/$name.typed.sizes" "$WORK/$name.raw.sizes"; then
+        echo "$name: the typed fields do not compile to the code of the raw masks, sizes typed and raw:"
+        cat "$WORK/$name.typed.sizes" "$WORK/$name.raw.sizes"
+        failed=$((failed + 1))
+    fi
+    for check in REGISTERS VALUE WIDTH; do
+        # shellcheck disable=SC2086
+        if $CXX $CXXFLAGS -DTEST_TYPED -DTEST_FAIL_$check -I"$TEST_DIR/host" -I"$TEST_DIR" -I"$SRC_DIR" -fsyntax-only \
+            "$1" 2>/dev/null; then
+            echo "$name: TEST_FAIL_$check built"
+            failed=$((failed + 1))
+        fi
+    done
+    if [ "$failed" -eq "$errors" ]; then
+        echo "$name: passed"
+    else
+        echo "$name: FAILED"
+    fi
+}
+
+run phydp83825_bist_test "$TEST_DIR/phydp83825_bist_test.c"
+run phydp83825_capture_test "$TEST_DIR/phydp83825_capture_test.c" "$SRC_DIR/fsl_phydp83825_capture.c"
+run phydp83825_checkpoint_test "$TEST_DIR/phydp83825_checkpoint_test.c"
+run phydp83825_config_test "$TEST_DIR/phydp83825_config_test.c"
+run phydp83825_fiber_test "$TEST_DIR/phydp83825_fiber_test.c"
+run phydp83825_lwip_test "$TEST_DIR/phydp83825_lwip_test.c" "$SRC_DIR/fsl_phydp83825_lwip.c"
+run phydp83825_retry_test "$TEST_DIR/phydp83825_retry_test.c"
+run phydp83825_script_test "$TEST_DIR/phydp83825_script_test.c"
+run phydp83825_watchdog_test "$TEST_DIR/phydp83825_watchdog_test.c"
+run phydp83825_wol_test "$TEST_DIR/phydp83825_wol_test.c"
+run phydp83825_pool_bench "$TEST_DIR/phydp83825_pool_bench.c" "$SRC_DIR/fsl_phydp83825_pool.c" -pthread
+run_cxx phydp83825_async_bench "$TEST_DIR/phydp83825_async_bench.cpp"
+check_regfield "$TEST_DIR/phydp83825_regfield_check.cpp"
+
+exit $failed
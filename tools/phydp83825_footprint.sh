@@ -0,0 +1,102 @@
+#!/bin/sh
+#
+# phydp83825_footprint.sh
+#
+#  Host footprint report for the DP83825 PHY driver build options, see fsl_phydp83825.h.
+#
+#  Usage: CC=arm-none-eabi-gcc CFLAGS="-mcpu=cortex-m7 -mthumb -Os -I<sdk includes>" \
+#         SIZE=arm-none-eabi-size NM=arm-none-eabi-nm phydp83825_footprint.sh [driver directory]
+#
+#  Builds fsl_phydp83825.c with every feature group, then with each group left out, and prints the
+#  code, data and bss of each build and the size of the resource the application allocates per PHY,
+#  next to what the group costs. Groups built on a disabled group are left out with it, the
+#  extended registers take Wake on LAN and the diagnostics along.
+#
+#  The last table lists the functions on the link path, PHY_DP83825_ProcessInterrupt() and
+#  PHY_DP83825_GetLinkStatus() down to the MDIO access, with the cache lines they take when
+#  executed in place from flash (CACHE_LINE bytes, 32 by default).
+
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:--Os}
+SIZE=${SIZE:-size}
+NM=${NM:-nm}
+CACHE_LINE=${CACHE_LINE:-32}
+SRC_DIR=${1:-$(dirname "$0")/..}
+
+HOT_PATH="PHY_DP83825_ProcessInterrupt PHY_DP83825_GetLinkStatus PHY_DP83825_GetLinkSpeedDuplex
+PHY_DP83825_GetLinkPause PHY_DP83825_ClearInterrupt PHY_DP83825_FlapInput PHY_DP83825_FlapReport
+PHY_DP83825_RaiseEvent PHY_DP83825_WatchdogObserve PHY_DP83825_WatchdogCheck PHY_DP83825_EnergyDetectLink
+PHY_DP83825_BeginCall PHY_DP83825_GetTimeUs PHY_DP83825_DeadlineExpired PHY_DP83825_DeadlineRemaining
+PHY_DP83825_Mdio PHY_DP83825_ShadowUpdate PHY_DP83825_PhaseUpdate PHY_DP83825_PhaseMark PHY_DP83825_PhaseStart"
+
+WORK=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORK"' EXIT
+
+# The resource size is read back from the symbol table, that works with cross compilers too.
+printf '#include "fsl_phydp83825.h"\nchar phy_dp83825_resource_size[sizeof(phy_dp83825_resource_t)] = {1};\n' \
+    >"$WORK/resource.c"
+
+# build <name> <defines...>, prints "text data bss resource" of the build.
+build()
+{
+    name=$1
+    shift
+    # shellcheck disable=SC2086
+    if ! $CC $CFLAGS "$@" -I"$SRC_DIR" -c "$SRC_DIR/fsl_phydp83825.c" -o "$WORK/$name.o" ||
+        ! $CC $CFLAGS "$@" -I"$SRC_DIR" -c "$WORK/resource.c" -o "$WORK/$name.resource.o"; then
+        echo "phydp83825_footprint: $name build failed" >&2
+        exit 1
+    fi
+    hex=$($NM -S "$WORK/$name.resource.o" | awk '$4 == "phy_dp83825_resource_size" { print $2 }')
+    $SIZE "$WORK/$name.o" | awk -v resource=$((0x$hex)) 'NR == 2 { print $1, $2, $3, resource }'
+}
+
+# report <name> <defines...>, prints the build next to its saving against the full build.
+report()
+{
+    name=$1
+    shift
+    result=$(build "$name" "$@") || exit 1
+    # shellcheck disable=SC2086
+    set -- $result
+    printf '%-16s %7d %6d %6d %8d %7d %6d %6d %9d\n' "$name" "$1" "$2" "$3" "$4" \
+        $((FULL_TEXT - $1)) $((FULL_DATA - $2)) $((FULL_BSS - $3)) $((FULL_RESOURCE - $4))
+}
+
+result=$(build full) || exit 1
+# shellcheck disable=SC2086
+set -- $result
+FULL_TEXT=$1
+FULL_DATA=$2
+FULL_BSS=$3
+FULL_RESOURCE=$4
+
+printf '%-16s %7s %6s %6s %8s %7s %6s %6s %9s\n' "build" "text" "data" "bss" "resource" "-text" "-data" "-bss" \
+    "-resource"
+report full
+report no-wol -DPHY_DP83825_ENABLE_WOL=0
+report no-loopback -DPHY_DP83825_ENABLE_LOOPBACK=0
+report no-ext -DPHY_DP83825_ENABLE_EXT=0
+report no-diagnostics -DPHY_DP83825_ENABLE_DIAGNOSTICS=0
+report no-telemetry -DPHY_DP83825_ENABLE_TELEMETRY=0
+report no-dp83822 -DPHY_DP83825_ENABLE_DP83822=0
+report no-dp83825 -DPHY_DP83825_ENABLE_DP83825=0
+report no-dp83826 -DPHY_DP83825_ENABLE_DP83826=0
+report minimal -DPHY_DP83825_ENABLE_EXT=0 -DPHY_DP83825_ENABLE_LOOPBACK=0 -DPHY_DP83825_ENABLE_TELEMETRY=0 \
+    -DPHY_DP83825_ENABLE_DP83822=0 -DPHY_DP83825_ENABLE_DP83826=0
+
+echo
+echo "Link path, functions inlined by the compiler do not show up"
+for name in full minimal; do
+    total=0
+    for symbol in $HOT_PATH; do
+        hex=$($NM -S "$WORK/$name.o" | awk -v s="$symbol" '$4 == s && ($3 == "T" || $3 == "t") { print $2 }')
+        if [ -n "$hex" ]; then
+            bytes=$((0x$hex))
+            total=$((total + bytes))
+            printf '%-16s %-36s %6d\n' "$name" "$symbol" "$bytes"
+        fi
+    done
+    printf '%-16s %-36s %6d bytes, %d cache lines\n' "$name" "total" "$total" \
+        $(((total + CACHE_LINE - 1) / CACHE_LINE))
+done
@@ -0,0 +1,264 @@
+/*
+ * phydp83825_tracedecode.c
+ *
+ *  Host decoder for DP83825 MDIO trace dumps, see fsl_phydp83825_trace.h.
+ *
+ *  Build: cc -O2 -o phydp83825_tracedecode phydp83825_tracedecode.c
+ *  Usage: phydp83825_tracedecode dump.bin
+ *
+ *  Reads trace dumps as well as MDIO captures, which use the same format.
+ *
+ *  Prints the access timeline, the per register access counts and a frame latency histogram.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TRACE_HEADER_SIZE (16U)
+#define TRACE_RECORD_SIZE (16U)
+#define TRACE_VERSION     (2U)
+#define TRACE_STREAM      (0xFFFFFFFFU)
+#define HISTOGRAM_BUCKETS (12U)
+
+typedef struct
+{
+    uint32_t timestamp;
+    uint16_t regAddr;
+    uint16_t value;
+    uint16_t duration;
+    uint16_t status;
+    uint8_t phyAddr;
+    uint8_t devAddr;
+    uint8_t op;
+} record_t;
+
+typedef struct
+{
+    uint16_t regAddr;
+    uint8_t ext;
+    const char *name;
+} reg_name_t;
+
+typedef struct
+{
+    uint16_t regAddr;
+    uint8_t devAddr;
+    uint8_t ext;
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t errors;
+} reg_count_t;
+
+static const reg_name_t s_regNames[] = {
+    {0x00U, 0U, "BMCR"},      {0x01U, 0U, "BMSR"},      {0x02U, 0U, "PHYIDR1"},   {0x03U, 0U, "PHYIDR2"},
+    {0x04U, 0U, "ANAR"},      {0x05U, 0U, "ANLPAR"},    {0x06U, 0U, "ANER"},      {0x07U, 0U, "ANNPTR"},
+    {0x09U, 0U, "CR1"},       {0x0AU, 0U, "CR2"},       {0x0BU, 0U, "CR3"},       {0x0DU, 0U, "REGCR"},
+    {0x0EU, 0U, "ADDAR"},     {0x0FU, 0U, "FLDS"},      {0x10U, 0U, "PHYSTS"},    {0x11U, 0U, "PHYSCR"},
+    {0x12U, 0U, "MISR1"},     {0x13U, 0U, "MISR2"},     {0x14U, 0U, "FCSCR"},     {0x15U, 0U, "RECR"},
+    {0x16U, 0U, "BISCR"},     {0x17U, 0U, "RCSR"},      {0x18U, 0U, "LEDCR"},     {0x19U, 0U, "PHYCR"},
+    {0x1AU, 0U, "10BTSCR"},   {0x1BU, 0U, "BICSR1"},    {0x1CU, 0U, "BICSR2"},    {0x1DU, 0U, "EDCR"},
+    {0x1EU, 0U, "CDCR"},      {0x1FU, 0U, "PHYRCR"},    {0x030BU, 1U, "VOD_CFG1"}, {0x030CU, 1U, "VOD_CFG2"},
+    {0x0465U, 1U, "GENCFG"},  {0x0467U, 1U, "SOR1"},    {0x04A0U, 1U, "WOL_CFG"}, {0x04A1U, 1U, "WOL_STAT"},
+    {0x04A2U, 1U, "WOL_DA1"}, {0x04A3U, 1U, "WOL_DA2"}, {0x04A4U, 1U, "WOL_DA3"}, {0x04A5U, 1U, "RXSOP1"},
+    {0x04A6U, 1U, "RXSOP2"},  {0x04A7U, 1U, "RXSOP3"},
+};
+
+static const char *const s_opNames[] = {"WR", "RD", "XWR", "XRD"};
+
+static uint32_t get16(const uint8_t *in)
+{
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8U);
+}
+
+static uint32_t get32(const uint8_t *in)
+{
+    return get16(in) | (get16(&in[2]) << 16U);
+}
+
+static const char *reg_name(uint16_t regAddr, int ext)
+{
+    size_t i;
+
+    for (i = 0U; i < (sizeof(s_regNames) / sizeof(s_regNames[0])); i++)
+    {
+        if ((s_regNames[i].regAddr == regAddr) && (s_regNames[i].ext == (uint8_t)ext))
+        {
+            return s_regNames[i].name;
+        }
+    }
+    return "?";
+}
+
+static unsigned int bucket(uint32_t duration)
+{
+    unsigned int index = 0U;
+
+    /* Bucket n holds durations below 2^(n + 4) us, the last one everything above. */
+    while ((index < (HISTOGRAM_BUCKETS - 1U)) && (duration >= (16U << index)))
+    {
+        index++;
+    }
+    return index;
+}
+
+int main(int argc, char **argv)
+{
+    static reg_count_t counts[1024];
+    uint32_t histogram[HISTOGRAM_BUCKETS] = {0};
+    size_t countsUsed                     = 0U;
+    uint8_t header[TRACE_HEADER_SIZE];
+    uint8_t raw[TRACE_RECORD_SIZE];
+    uint32_t count, lost, i, prev = 0U, maxDuration = 0U;
+    uint64_t totalDuration = 0U;
+    FILE *file;
+    size_t j;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s dump.bin\n", argv[0]);
+        return 2;
+    }
+    file = fopen(argv[1], "rb");
+    if (file == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    if ((fread(header, 1U, sizeof(header), file) != sizeof(header)) || (memcmp(header, "PTRC", 4U) != 0))
+    {
+        fprintf(stderr, "%s: not a trace dump\n", argv[1]);
+        return 1;
+    }
+    /* Version 1 kept the status in one byte, its zeroed reserved byte makes the 16-bit read work. */
+    if ((header[4] == 0U) || (header[4] > TRACE_VERSION) || (header[5] < TRACE_RECORD_SIZE))
+    {
+        fprintf(stderr, "%s: unsupported version %u, record size %u\n", argv[1], header[4], header[5]);
+        return 1;
+    }
+    count = get32(&header[8]);
+    lost  = get32(&header[12]);
+
+    if (count == TRACE_STREAM)
+    {
+        printf("capture, %u lost\n\n", lost);
+    }
+    else
+    {
+        printf("%u records, %u lost\n\n", count, lost);
+    }
+    printf("%10s %8s %5s %-4s %-3s %-10s %6s %6s %s\n", "time_us", "delta", "phy", "op", "dev", "reg", "value",
+           "dur_us", "status");
+    for (i = 0U; (count == TRACE_STREAM) || (i < count); i++)
+    {
+        record_t rec;
+        int ext;
+
+        if (fread(raw, 1U, sizeof(raw), file) != sizeof(raw))
+        {
+            if (count == TRACE_STREAM)
+            {
+                break;
+            }
+            fprintf(stderr, "%s: truncated at record %u\n", argv[1], i);
+            return 1;
+        }
+        if (header[5] > TRACE_RECORD_SIZE)
+        {
+            (void)fseek(file, (long)(header[5] - TRACE_RECORD_SIZE), SEEK_CUR);
+        }
+        rec.timestamp = get32(&raw[0]);
+        rec.regAddr   = (uint16_t)get16(&raw[4]);
+        rec.value     = (uint16_t)get16(&raw[6]);
+        rec.duration  = (uint16_t)get16(&raw[8]);
+        rec.phyAddr   = raw[10];
+        rec.devAddr   = raw[11];
+        rec.op        = raw[12];
+        rec.status    = (uint16_t)get16(&raw[13]);
+        ext           = (rec.op >= 2U) ? 1 : 0;
+
+        printf("%10u %8u %5u %-4s ", rec.timestamp, (i == 0U) ? 0U : (rec.timestamp - prev), rec.phyAddr,
+               (rec.op < 4U) ? s_opNames[rec.op] : "??");
+        if (ext != 0)
+        {
+            printf("%-3u ", rec.devAddr);
+        }
+        else
+        {
+            printf("%-3s ", "-");
+        }
+        printf("%-10s 0x%04x %6u ", reg_name(rec.regAddr, ext), rec.value, rec.duration);
+        if (rec.status == 0U)
+        {
+            printf("ok\n");
+        }
+        else
+        {
+            printf("ERR %u\n", rec.status);
+        }
+        prev = rec.timestamp;
+
+        histogram[bucket(rec.duration)]++;
+        totalDuration += rec.duration;
+        if (rec.duration > maxDuration)
+        {
+            maxDuration = rec.duration;
+        }
+
+        for (j = 0U; j < countsUsed; j++)
+        {
+            if ((counts[j].regAddr == rec.regAddr) && (counts[j].ext == (uint8_t)ext) &&
+                (counts[j].devAddr == ((ext != 0) ? rec.devAddr : 0U)))
+            {
+                break;
+            }
+        }
+        if (j == countsUsed)
+        {
+            if (countsUsed == (sizeof(counts) / sizeof(counts[0])))
+            {
+                continue;
+            }
+            counts[j].regAddr = rec.regAddr;
+            counts[j].devAddr = (ext != 0) ? rec.devAddr : 0U;
+            counts[j].ext     = (uint8_t)ext;
+            countsUsed++;
+        }
+        if ((rec.op & 1U) != 0U)
+        {
+            counts[j].reads++;
+        }
+        else
+        {
+            counts[j].writes++;
+        }
+        if (rec.status != 0U)
+        {
+            counts[j].errors++;
+        }
+    }
+    (void)fclose(file);
+    count = i;
+
+    printf("\n%-10s %-3s %6s %8s %8s %8s\n", "reg", "dev", "addr", "reads", "writes", "errors");
+    for (j = 0U; j < countsUsed; j++)
+    {
+        printf("%-10s %-3u 0x%04x %8u %8u %8u\n", reg_name(counts[j].regAddr, counts[j].ext), counts[j].devAddr,
+               counts[j].regAddr, counts[j].reads, counts[j].writes, counts[j].errors);
+    }
+
+    printf("\nframe latency, avg %u us, max %u us\n", (count != 0U) ? (uint32_t)(totalDuration / count) : 0U,
+           maxDuration);
+    for (i = 0U; i < HISTOGRAM_BUCKETS; i++)
+    {
+        if (i < (HISTOGRAM_BUCKETS - 1U))
+        {
+            printf("  < %6u us %8u\n", 16U << i, histogram[i]);
+        }
+        else
+        {
+            printf(" >= %6u us %8u\n", 16U << (i - 1U), histogram[i]);
+        }
+    }
+    return 0;
+}